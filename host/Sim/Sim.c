@@ -0,0 +1,1312 @@
+/**
+ * @file Sim.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Simulated register backend of the host (Linux) build.
+ * @version 0.1
+ * @date 2024-04-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Each block of register images is a shared memory object mapped twice: once at the real
+ * peripheral address with no access rights, so that firmware accesses fault, and once at an
+ * address chosen by the kernel that the backend uses to implement the peripheral models.
+ *
+ * On a fault the access is counted, the page is unlocked and the trap flag is set. The faulting
+ * instruction then executes normally and the following trap locks the page again and runs the
+ * model of the peripheral with the value that was read or written.
+ *
+ * The bit-band alias words are mapped the same way. A read finds the bit of the target register
+ * already copied in the word, and a write is applied to that bit before the model runs.
+ */
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#define _GNU_SOURCE
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include "Sim.h"
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "The simulated register backend requires an x86-64 Linux host"
+#endif
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define SIM_PAGE_SIZE           0x1000UL
+#define SIM_MAX_PENDING         4UL
+#define SIM_NO_PERIPH           _SIM_NUM_OF_PERIPHS
+
+/* Bit-band alias of the peripherals, bit n of the word at 0x40000000 + x is the word at 0x42000000 + 32x + 4n */
+#define BITBAND_PERIPH_BASE     0x40000000UL
+#define BITBAND_ALIAS_BASE      0x42000000UL
+#define BITBAND_ALIAS_SIZE      0x02000000UL
+#define IS_BITBAND_ALIAS(A)     (((A) >= BITBAND_ALIAS_BASE) && ((A) < (BITBAND_ALIAS_BASE + BITBAND_ALIAS_SIZE)))
+
+#define X86_EFLAGS_TF           0x100UL
+#define X86_PF_WRITE            0x2UL
+
+/* GPIO registers */
+#define GPIO_MODER              0x00UL
+#define GPIO_IDR                0x10UL
+#define GPIO_ODR                0x14UL
+#define GPIO_BSRR               0x18UL
+#define GPIO_MODE_OUTPUT        0x1UL
+
+/* RCC registers */
+#define RCC_CR                  0x00UL
+#define RCC_PLLCFGR             0x04UL
+#define RCC_CFGR                0x08UL
+#define RCC_CR_ON_MASK          ((1UL << 0) | (1UL << 16) | (1UL << 24) | (1UL << 26))
+#define RCC_CFGR_SW_MASK        0x3UL
+
+/* SYSCFG and EXTI registers */
+#define SYSCFG_EXTICR1          0x08UL
+#define EXTI_IMR                0x00UL
+#define EXTI_SWIER              0x10UL
+#define EXTI_PR                 0x14UL
+#define EXTI_RTSR               0x08UL
+#define EXTI_FTSR               0x0CUL
+#define EXTI_NUM_OF_GPIO_LINES  16UL
+#define EXTICR_PORT_GPIOH       0x7UL
+
+/* TIM1 registers */
+#define TIM_CR1                 0x00UL
+#define TIM_DIER                0x0CUL
+#define TIM_SR                  0x10UL
+#define TIM_EGR                 0x14UL
+#define TIM_CNT                 0x24UL
+#define TIM_PSC                 0x28UL
+#define TIM_ARR                 0x2CUL
+#define TIM_CR1_CEN             (1UL << 0)
+#define TIM_CR1_URS             (1UL << 2)
+#define TIM_DIER_UIE            (1UL << 0)
+#define TIM_DIER_UDE            (1UL << 8)
+#define TIM_SR_UIF              (1UL << 0)
+#define TIM_EGR_UG              (1UL << 0)
+#define TIM1_UP_IRQ             25UL
+
+/* DMA2 registers */
+#define DMA_LISR                0x00UL
+#define DMA_HISR                0x04UL
+#define DMA_LIFCR               0x08UL
+#define DMA_HIFCR               0x0CUL
+#define DMA_STREAM_SIZE         0x18UL
+#define DMA_STREAM(N)           (0x10UL + ((N) * DMA_STREAM_SIZE))
+#define DMA_SxCR                0x00UL
+#define DMA_SxNDTR              0x04UL
+#define DMA_SxPAR               0x08UL
+#define DMA_SxM0AR              0x0CUL
+#define DMA_SxM1AR              0x10UL
+#define DMA_SxCR_EN             (1UL << 0)
+#define DMA_SxCR_TEIE           (1UL << 2)
+#define DMA_SxCR_HTIE           (1UL << 3)
+#define DMA_SxCR_TCIE           (1UL << 4)
+#define DMA_SxCR_DIR_POS        6UL
+#define DMA_SxCR_CIRC           (1UL << 8)
+#define DMA_SxCR_MINC           (1UL << 10)
+#define DMA_SxCR_MSIZE_POS      13UL
+#define DMA_SxCR_DBM            (1UL << 18)
+#define DMA_SxCR_CT             (1UL << 19)
+#define DMA_SxCR_CHSEL_POS      25UL
+#define DMA_FLAG_TEIF           (1UL << 3)
+#define DMA_FLAG_HTIF           (1UL << 4)
+#define DMA_FLAG_TCIF           (1UL << 5)
+#define DMA_NUM_OF_STREAMS      8UL
+#define DMA_DIR_PERIPH_TO_MEM   0UL
+#define DMA_DIR_MEM_TO_PERIPH   1UL
+#define DMA_TIM1_UP_STREAM      5UL
+#define DMA_TIM1_UP_CHANNEL     6UL
+
+/* SysTick registers */
+#define SYSTICK_CTRL            0x00UL
+#define SYSTICK_LOAD            0x04UL
+#define SYSTICK_VAL             0x08UL
+#define SYSTICK_CTRL_ENABLE     (1UL << 0)
+#define SYSTICK_CTRL_TICKINT    (1UL << 1)
+#define SYSTICK_CTRL_CLKSOURCE  (1UL << 2)
+#define SYSTICK_CTRL_COUNTFLAG  (1UL << 16)
+#define SYSTICK_CTRL_RW_MASK    (SYSTICK_CTRL_ENABLE | SYSTICK_CTRL_TICKINT | SYSTICK_CTRL_CLKSOURCE)
+#define SYSTICK_MAX_RELOAD      0xFFFFFFUL
+
+/* NVIC registers, each bank is 8 words */
+#define NVIC_ISER               0x000UL
+#define NVIC_ICER               0x080UL
+#define NVIC_ISPR               0x100UL
+#define NVIC_ICPR               0x180UL
+#define NVIC_BANK_SIZE          0x20UL
+#define NVIC_NUM_OF_WORDS       8UL
+#define NVIC_NUM_OF_IRQS        (NVIC_NUM_OF_WORDS * 32UL)
+
+/* Instruction counting */
+#define SIM_COUNT_OFF           0UL
+#define SIM_COUNT_RUNNING       1UL
+#define SIM_COUNT_STOPPING      2UL
+
+#define IS_GPIO_PERIPH(P)       ((P) <= SIM_PERIPH_GPIOH)
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Contiguous range of register images sharing one mapping.
+ */
+typedef struct
+{
+    uint32_t Base;      /**< First address, page aligned */
+    uint32_t Size;      /**< Size in bytes, multiple of a page */
+    uint8_t *Alias;     /**< Unprotected view used by the models */
+} Block_t;
+
+/**
+ * @brief Simulated peripheral.
+ */
+typedef struct
+{
+    const char *Name;
+    uint32_t Base;
+    uint32_t Size;
+    Sim_AccessHook_t ReadHook;
+    Sim_AccessHook_t WriteHook;
+    Sim_AccessCount_t Count;
+} Periph_t;
+
+/**
+ * @brief Access being single-stepped.
+ */
+typedef struct
+{
+    uintptr_t Page;
+    uint32_t Address;       /**< Register accessed, the one behind the alias word for a bit-band access */
+    uint32_t Periph;
+    uint32_t IsWrite;
+    uint32_t IsBitBand;
+    uint32_t AliasAddress;  /**< Alias word of a bit-band access */
+    uint32_t Bit;           /**< Bit of the register of a bit-band access */
+} PendingAccess_t;
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void EXTI0_IRQHandler(void) __attribute__((weak));
+extern void EXTI1_IRQHandler(void) __attribute__((weak));
+extern void EXTI2_IRQHandler(void) __attribute__((weak));
+extern void EXTI3_IRQHandler(void) __attribute__((weak));
+extern void EXTI4_IRQHandler(void) __attribute__((weak));
+extern void EXTI9_5_IRQHandler(void) __attribute__((weak));
+extern void EXTI15_10_IRQHandler(void) __attribute__((weak));
+extern void TIM1_UP_TIM10_IRQHandler(void) __attribute__((weak));
+extern void DMA2_Stream0_IRQHandler(void) __attribute__((weak));
+extern void DMA2_Stream1_IRQHandler(void) __attribute__((weak));
+extern void DMA2_Stream2_IRQHandler(void) __attribute__((weak));
+extern void DMA2_Stream3_IRQHandler(void) __attribute__((weak));
+extern void DMA2_Stream4_IRQHandler(void) __attribute__((weak));
+extern void DMA2_Stream5_IRQHandler(void) __attribute__((weak));
+extern void DMA2_Stream6_IRQHandler(void) __attribute__((weak));
+extern void DMA2_Stream7_IRQHandler(void) __attribute__((weak));
+
+/* Vector table of the modelled interrupts, indexed by IRQ number */
+static void (* const IrqHandlers[])(void) =
+{
+    [6]  = EXTI0_IRQHandler,
+    [7]  = EXTI1_IRQHandler,
+    [8]  = EXTI2_IRQHandler,
+    [9]  = EXTI3_IRQHandler,
+    [10] = EXTI4_IRQHandler,
+    [23] = EXTI9_5_IRQHandler,
+    [25] = TIM1_UP_TIM10_IRQHandler,
+    [40] = EXTI15_10_IRQHandler,
+    [56] = DMA2_Stream0_IRQHandler,
+    [57] = DMA2_Stream1_IRQHandler,
+    [58] = DMA2_Stream2_IRQHandler,
+    [59] = DMA2_Stream3_IRQHandler,
+    [60] = DMA2_Stream4_IRQHandler,
+    [68] = DMA2_Stream5_IRQHandler,
+    [69] = DMA2_Stream6_IRQHandler,
+    [70] = DMA2_Stream7_IRQHandler,
+};
+
+/* IRQ number of each DMA2 stream */
+static const uint8_t Dma2StreamIrqs[DMA_NUM_OF_STREAMS] = {56, 57, 58, 59, 60, 68, 69, 70};
+
+/* Position of the flags of a stream in LISR/HISR, indexed by stream % 4 */
+static const uint8_t DmaFlagShifts[4] = {0, 6, 16, 22};
+
+static Block_t Blocks[] =
+{
+    {0x40010000UL, 0x4000UL, NULL},     /* TIM1..EXTI */
+    {0x40020000UL, 0x4000UL, NULL},     /* GPIOA..GPIOH, RCC */
+    {0x40026000UL, 0x1000UL, NULL},     /* DMA1, DMA2 */
+    {0xE000E000UL, 0x1000UL, NULL},     /* System control space */
+    {0x42200000UL, 0x80000UL, NULL},    /* Bit-band alias of TIM1..EXTI */
+    {0x42400000UL, 0x80000UL, NULL},    /* Bit-band alias of GPIOA..GPIOH, RCC */
+};
+
+static void GpioWrite(uint32_t Offset, uint32_t Value);
+static void RccWrite(uint32_t Offset, uint32_t Value);
+static void SysTickRead(uint32_t Offset, uint32_t Value);
+static void SysTickWrite(uint32_t Offset, uint32_t Value);
+static void NvicWrite(uint32_t Offset, uint32_t Value);
+static void ExtiWrite(uint32_t Offset, uint32_t Value);
+static void TimWrite(uint32_t Offset, uint32_t Value);
+static void DmaWrite(uint32_t Offset, uint32_t Value);
+
+/* Looked up in order, so the SCB range overlapping SysTick and NVIC comes last */
+static Periph_t Periphs[_SIM_NUM_OF_PERIPHS] =
+{
+    [SIM_PERIPH_GPIOA]   = {"GPIOA",   0x40020000UL, 0x400UL, NULL, GpioWrite, {0, 0}},
+    [SIM_PERIPH_GPIOB]   = {"GPIOB",   0x40020400UL, 0x400UL, NULL, GpioWrite, {0, 0}},
+    [SIM_PERIPH_GPIOC]   = {"GPIOC",   0x40020800UL, 0x400UL, NULL, GpioWrite, {0, 0}},
+    [SIM_PERIPH_GPIOD]   = {"GPIOD",   0x40020C00UL, 0x400UL, NULL, GpioWrite, {0, 0}},
+    [SIM_PERIPH_GPIOE]   = {"GPIOE",   0x40021000UL, 0x400UL, NULL, GpioWrite, {0, 0}},
+    [SIM_PERIPH_GPIOH]   = {"GPIOH",   0x40021C00UL, 0x400UL, NULL, GpioWrite, {0, 0}},
+    [SIM_PERIPH_RCC]     = {"RCC",     0x40023800UL, 0x400UL, NULL, RccWrite, {0, 0}},
+    [SIM_PERIPH_SYSCFG]  = {"SYSCFG",  0x40013800UL, 0x400UL, NULL, NULL, {0, 0}},
+    [SIM_PERIPH_EXTI]    = {"EXTI",    0x40013C00UL, 0x400UL, NULL, ExtiWrite, {0, 0}},
+    [SIM_PERIPH_TIM1]    = {"TIM1",    0x40010000UL, 0x400UL, NULL, TimWrite, {0, 0}},
+    [SIM_PERIPH_DMA2]    = {"DMA2",    0x40026400UL, 0x400UL, NULL, DmaWrite, {0, 0}},
+    [SIM_PERIPH_SYSTICK] = {"SysTick", 0xE000E010UL, 0x010UL, SysTickRead, SysTickWrite, {0, 0}},
+    [SIM_PERIPH_NVIC]    = {"NVIC",    0xE000E100UL, 0x400UL, NULL, NvicWrite, {0, 0}},
+    [SIM_PERIPH_SCB]     = {"SCB",     0xE000E008UL, 0xD88UL, NULL, NULL, {0, 0}},
+};
+
+/* Built-in models, restored by Sim_init() */
+static const Sim_AccessHook_t DefaultReadHooks[_SIM_NUM_OF_PERIPHS] =
+{
+    [SIM_PERIPH_SYSTICK] = SysTickRead,
+};
+static const Sim_AccessHook_t DefaultWriteHooks[_SIM_NUM_OF_PERIPHS] =
+{
+    [SIM_PERIPH_GPIOA] = GpioWrite, [SIM_PERIPH_GPIOB] = GpioWrite, [SIM_PERIPH_GPIOC] = GpioWrite,
+    [SIM_PERIPH_GPIOD] = GpioWrite, [SIM_PERIPH_GPIOE] = GpioWrite, [SIM_PERIPH_GPIOH] = GpioWrite,
+    [SIM_PERIPH_RCC] = RccWrite, [SIM_PERIPH_EXTI] = ExtiWrite, [SIM_PERIPH_TIM1] = TimWrite,
+    [SIM_PERIPH_DMA2] = DmaWrite, [SIM_PERIPH_SYSTICK] = SysTickWrite, [SIM_PERIPH_NVIC] = NvicWrite,
+};
+
+static PendingAccess_t Pending[SIM_MAX_PENDING];
+static volatile uint32_t PendingCount;
+
+static uint32_t PinInputs[SIM_PERIPH_GPIOH + 1];
+
+static uint64_t NowCycles;
+static uint64_t LimitCycles;
+static jmp_buf *RunExit;
+
+static uint32_t CurrentPeriph;
+
+static volatile uint32_t Counting;
+static volatile uint64_t InstructionCount;
+
+static uint32_t Primask;
+static uint32_t SysTickPending;
+static uint32_t SysTickCountFlag;
+static uint32_t SysTickPhase;
+static uint32_t InHandler;
+static uint64_t TakenInterrupts;
+
+static uint32_t NvicEnabled[NVIC_NUM_OF_WORDS];
+static uint32_t NvicPending[NVIC_NUM_OF_WORDS];
+
+static uint32_t ExtiPending;
+
+static uint64_t TimCycles;                          /* Cycles elapsed in the current TIM1 period */
+static uint32_t TimStatus;
+static uint32_t DmaFlags[2];                        /* LISR and HISR */
+static uint32_t DmaEnabled;                         /* Streams enabled, to detect the enabling writes */
+static uint32_t DmaNumOfData[DMA_NUM_OF_STREAMS];   /* NDTR when the stream was enabled */
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static Block_t *FindBlock(uintptr_t Address);
+static uint32_t FindPeriph(uint32_t Address);
+static uint32_t *Reg(uint32_t Address);
+static uint32_t *PeriphReg(Sim_Peripheral_t Peripheral, uint32_t Offset);
+static void LoadResetValues(void);
+static void UpdateIdr(Sim_Peripheral_t Port);
+static void ExtiDetectEdges(Sim_Peripheral_t Port, uint32_t OldLevels, uint32_t NewLevels);
+static void ExtiUpdateIrqs(void);
+static void PendIrq(uint32_t Irq);
+static void UpdateIrqs(void);
+static void BusWrite(uint32_t Address, uint32_t Value);
+static void *HostAddress(uint32_t Address);
+static uint64_t CyclesToTimEvent(void);
+static void TimUpdate(void);
+static void TimAdvance(uint64_t Cycles);
+static uint32_t *DmaStreamReg(uint32_t Stream, uint32_t Offset);
+static void DmaSetFlags(uint32_t Stream, uint32_t Flags);
+static void DmaRequest(uint32_t Stream, uint32_t Channel);
+static uint32_t IsInterruptPending(void);
+static uint64_t CyclesToSysTickEvent(void);
+static void SysTickAdvance(uint64_t Cycles);
+static void TakePendingInterrupts(void);
+static void CheckTimeLimit(void);
+static void SegvHandler(int Signal, siginfo_t *Info, void *Context);
+static void TrapHandler(int Signal, siginfo_t *Info, void *Context);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+static Block_t *FindBlock(uintptr_t Address)
+{
+    uint32_t idx;
+    for(idx = 0; idx < (sizeof(Blocks) / sizeof(Blocks[0])); idx++)
+    {
+        if((Address >= Blocks[idx].Base) && (Address < ((uintptr_t)Blocks[idx].Base + Blocks[idx].Size)))
+        {
+            return &Blocks[idx];
+        }
+    }
+    return NULL;
+}
+
+static uint32_t FindPeriph(uint32_t Address)
+{
+    uint32_t idx;
+    for(idx = 0; idx < _SIM_NUM_OF_PERIPHS; idx++)
+    {
+        if((Address >= Periphs[idx].Base) && (Address < (Periphs[idx].Base + Periphs[idx].Size)))
+        {
+            return idx;
+        }
+    }
+    return SIM_NO_PERIPH;
+}
+
+static uint32_t *Reg(uint32_t Address)
+{
+    Block_t *Block = FindBlock(Address);
+    return (uint32_t *)(Block->Alias + ((Address & ~3UL) - Block->Base));
+}
+
+static uint32_t *PeriphReg(Sim_Peripheral_t Peripheral, uint32_t Offset)
+{
+    return Reg(Periphs[Peripheral].Base + Offset);
+}
+
+static void LoadResetValues(void)
+{
+    uint32_t idx;
+
+    for(idx = 0; idx < (sizeof(Blocks) / sizeof(Blocks[0])); idx++)
+    {
+        memset(Blocks[idx].Alias, 0, Blocks[idx].Size);
+    }
+
+    /* Debug pins are in alternate function mode after reset */
+    *PeriphReg(SIM_PERIPH_GPIOA, 0x00) = 0xA8000000UL;
+    *PeriphReg(SIM_PERIPH_GPIOA, 0x08) = 0x0C000000UL;
+    *PeriphReg(SIM_PERIPH_GPIOA, 0x0C) = 0x64000000UL;
+    *PeriphReg(SIM_PERIPH_GPIOB, 0x00) = 0x00000280UL;
+    *PeriphReg(SIM_PERIPH_GPIOB, 0x08) = 0x000000C0UL;
+    *PeriphReg(SIM_PERIPH_GPIOB, 0x0C) = 0x00000100UL;
+
+    /* HSI on and ready, running from HSI */
+    *PeriphReg(SIM_PERIPH_RCC, RCC_CR) = 0x00000083UL;
+    *PeriphReg(SIM_PERIPH_RCC, RCC_PLLCFGR) = 0x24003010UL;
+}
+
+/* IDR follows ODR on output pins and the external level on the other ones */
+static void UpdateIdr(Sim_Peripheral_t Port)
+{
+    uint32_t Moder = *PeriphReg(Port, GPIO_MODER);
+    uint32_t OutputMask = 0;
+    uint32_t Pin;
+
+    for(Pin = 0; Pin < 16; Pin++)
+    {
+        if(((Moder >> (Pin * 2)) & 0x3UL) == GPIO_MODE_OUTPUT)
+        {
+            OutputMask |= 1UL << Pin;
+        }
+    }
+
+    uint32_t *Idr = PeriphReg(Port, GPIO_IDR);
+    uint32_t OldLevels = *Idr;
+
+    *Idr = (*PeriphReg(Port, GPIO_ODR) & OutputMask) | (PinInputs[Port] & ~OutputMask & 0xFFFFUL);
+    ExtiDetectEdges(Port, OldLevels, *Idr);
+}
+
+/* Latches the selected edges of the lines connected to Port, the EXTI sees the pin level whatever its mode.
+   PR latches the edges of masked lines too, only their interrupt is held back */
+static void ExtiDetectEdges(Sim_Peripheral_t Port, uint32_t OldLevels, uint32_t NewLevels)
+{
+    uint32_t PortCode = (Port == SIM_PERIPH_GPIOH) ? EXTICR_PORT_GPIOH : (uint32_t)Port;
+    uint32_t Rising = ~OldLevels & NewLevels & *PeriphReg(SIM_PERIPH_EXTI, EXTI_RTSR);
+    uint32_t Falling = OldLevels & ~NewLevels & *PeriphReg(SIM_PERIPH_EXTI, EXTI_FTSR);
+    uint32_t Edges = Rising | Falling;
+    uint32_t Line;
+
+    for(Line = 0; Edges && (Line < EXTI_NUM_OF_GPIO_LINES); Line++)
+    {
+        uint32_t Exticr = *PeriphReg(SIM_PERIPH_SYSCFG, SYSCFG_EXTICR1 + ((Line / 4) * 4));
+
+        if((Edges & (1UL << Line)) && (((Exticr >> ((Line % 4) * 4)) & 0xFUL) == PortCode))
+        {
+            ExtiPending |= 1UL << Line;
+        }
+    }
+    ExtiUpdateIrqs();
+}
+
+/* Pends the interrupt of every line whose request is pending and unmasked, like the level sensitive hardware */
+static void ExtiUpdateIrqs(void)
+{
+    uint32_t Requests = ExtiPending & *PeriphReg(SIM_PERIPH_EXTI, EXTI_IMR);
+    uint32_t Line;
+
+    *PeriphReg(SIM_PERIPH_EXTI, EXTI_PR) = ExtiPending;
+    for(Line = 0; Requests && (Line < EXTI_NUM_OF_GPIO_LINES); Line++)
+    {
+        if(Requests & (1UL << Line))
+        {
+            PendIrq((Line <= 4) ? (6 + Line) : ((Line <= 9) ? 23 : 40));
+        }
+    }
+}
+
+static void PendIrq(uint32_t Irq)
+{
+    NvicPending[Irq / 32] |= 1UL << (Irq % 32);
+    *PeriphReg(SIM_PERIPH_NVIC, NVIC_ISPR + ((Irq / 32) * 4)) = NvicPending[Irq / 32];
+    *PeriphReg(SIM_PERIPH_NVIC, NVIC_ICPR + ((Irq / 32) * 4)) = NvicPending[Irq / 32];
+}
+
+/* Pends the interrupt of every peripheral holding an enabled request, the requests are levels */
+static void UpdateIrqs(void)
+{
+    uint32_t Stream;
+
+    ExtiUpdateIrqs();
+
+    if(TimStatus & *PeriphReg(SIM_PERIPH_TIM1, TIM_DIER) & TIM_DIER_UIE)
+    {
+        PendIrq(TIM1_UP_IRQ);
+    }
+
+    for(Stream = 0; Stream < DMA_NUM_OF_STREAMS; Stream++)
+    {
+        uint32_t Flags = DmaFlags[Stream / 4] >> DmaFlagShifts[Stream % 4];
+        uint32_t Cr = *DmaStreamReg(Stream, DMA_SxCR);
+
+        if(((Flags & DMA_FLAG_TCIF) && (Cr & DMA_SxCR_TCIE)) ||
+           ((Flags & DMA_FLAG_HTIF) && (Cr & DMA_SxCR_HTIE)) ||
+           ((Flags & DMA_FLAG_TEIF) && (Cr & DMA_SxCR_TEIE)))
+        {
+            PendIrq(Dma2StreamIrqs[Stream]);
+        }
+    }
+}
+
+/* Write made by the DMA, with the side effects of the peripheral model but not counted */
+static void BusWrite(uint32_t Address, uint32_t Value)
+{
+    uint32_t Periph = FindPeriph(Address);
+
+    if(FindBlock(Address) == NULL)
+    {
+        return;
+    }
+    *Reg(Address) = Value;
+    if((Periph != SIM_NO_PERIPH) && Periphs[Periph].WriteHook)
+    {
+        CurrentPeriph = Periph;
+        Periphs[Periph].WriteHook((Address & ~3UL) - Periphs[Periph].Base, Value);
+    }
+}
+
+/* Firmware memory seen by the DMA, the static data of the image share the high half of their address */
+static void *HostAddress(uint32_t Address)
+{
+    return (void *)(((uintptr_t)&NowCycles & ~(uintptr_t)0xFFFFFFFFUL) | Address);
+}
+
+static void ExtiWrite(uint32_t Offset, uint32_t Value)
+{
+    switch(Offset)
+    {
+        case EXTI_PR:
+            /* Write one to clear */
+            ExtiPending &= ~Value;
+            break;
+        case EXTI_SWIER:
+            ExtiPending |= Value & *PeriphReg(SIM_PERIPH_EXTI, EXTI_IMR);
+            *PeriphReg(SIM_PERIPH_EXTI, EXTI_SWIER) = 0;
+            break;
+        default:
+            break;
+    }
+    ExtiUpdateIrqs();
+}
+
+static void TimWrite(uint32_t Offset, uint32_t Value)
+{
+    uint32_t Prescaler = *PeriphReg(SIM_PERIPH_TIM1, TIM_PSC) + 1;
+
+    switch(Offset)
+    {
+        case TIM_SR:
+            /* Write zero to clear */
+            TimStatus &= Value;
+            break;
+        case TIM_EGR:
+            /* The update generated by software reinitializes the counter */
+            *PeriphReg(SIM_PERIPH_TIM1, TIM_EGR) = 0;
+            if(Value & TIM_EGR_UG)
+            {
+                TimCycles = 0;
+                *PeriphReg(SIM_PERIPH_TIM1, TIM_CNT) = 0;
+                if(!(*PeriphReg(SIM_PERIPH_TIM1, TIM_CR1) & TIM_CR1_URS))
+                {
+                    TimUpdate();
+                }
+            }
+            break;
+        case TIM_CNT:
+            TimCycles = (uint64_t)(Value & 0xFFFFUL) * Prescaler;
+            break;
+        default:
+            break;
+    }
+    *PeriphReg(SIM_PERIPH_TIM1, TIM_SR) = TimStatus;
+    UpdateIrqs();
+}
+
+/* Cycles until the next TIM1 update event, UINT64_MAX when the counter is stopped */
+static uint64_t CyclesToTimEvent(void)
+{
+    uint64_t Period = ((uint64_t)*PeriphReg(SIM_PERIPH_TIM1, TIM_PSC) + 1) * ((uint64_t)*PeriphReg(SIM_PERIPH_TIM1, TIM_ARR) + 1);
+
+    if(!(*PeriphReg(SIM_PERIPH_TIM1, TIM_CR1) & TIM_CR1_CEN))
+    {
+        return UINT64_MAX;
+    }
+    return (TimCycles < Period) ? (Period - TimCycles) : 1;
+}
+
+static void TimUpdate(void)
+{
+    TimStatus |= TIM_SR_UIF;
+    *PeriphReg(SIM_PERIPH_TIM1, TIM_SR) = TimStatus;
+    if(*PeriphReg(SIM_PERIPH_TIM1, TIM_DIER) & TIM_DIER_UDE)
+    {
+        DmaRequest(DMA_TIM1_UP_STREAM, DMA_TIM1_UP_CHANNEL);
+    }
+    UpdateIrqs();
+}
+
+/* The prescaler and auto-reload values are used as written, their preload is not modelled */
+static void TimAdvance(uint64_t Cycles)
+{
+    uint64_t Prescaler = (uint64_t)*PeriphReg(SIM_PERIPH_TIM1, TIM_PSC) + 1;
+    uint64_t Period = Prescaler * ((uint64_t)*PeriphReg(SIM_PERIPH_TIM1, TIM_ARR) + 1);
+
+    if(!(*PeriphReg(SIM_PERIPH_TIM1, TIM_CR1) & TIM_CR1_CEN))
+    {
+        return;
+    }
+
+    TimCycles += Cycles;
+    while(TimCycles >= Period)
+    {
+        TimCycles -= Period;
+        TimUpdate();
+    }
+    *PeriphReg(SIM_PERIPH_TIM1, TIM_CNT) = (uint32_t)(TimCycles / Prescaler);
+}
+
+static uint32_t *DmaStreamReg(uint32_t Stream, uint32_t Offset)
+{
+    return PeriphReg(SIM_PERIPH_DMA2, DMA_STREAM(Stream) + Offset);
+}
+
+static void DmaSetFlags(uint32_t Stream, uint32_t Flags)
+{
+    DmaFlags[Stream / 4] |= Flags << DmaFlagShifts[Stream % 4];
+    *PeriphReg(SIM_PERIPH_DMA2, DMA_LISR) = DmaFlags[0];
+    *PeriphReg(SIM_PERIPH_DMA2, DMA_HISR) = DmaFlags[1];
+}
+
+/* Moves one data of the stream if it is enabled and listens to the requesting channel */
+static void DmaRequest(uint32_t Stream, uint32_t Channel)
+{
+    uint32_t *Cr = DmaStreamReg(Stream, DMA_SxCR);
+    uint32_t *Ndtr = DmaStreamReg(Stream, DMA_SxNDTR);
+    uint32_t Size = 1UL << ((*Cr >> DMA_SxCR_MSIZE_POS) & 0x3UL);
+    uint32_t Direction = (*Cr >> DMA_SxCR_DIR_POS) & 0x3UL;
+    uint32_t Memory;
+    uint32_t Value = 0;
+
+    if(!(*Cr & DMA_SxCR_EN) || (((*Cr >> DMA_SxCR_CHSEL_POS) & 0x7UL) != Channel) || (*Ndtr == 0))
+    {
+        return;
+    }
+
+    Memory = *DmaStreamReg(Stream, ((*Cr & DMA_SxCR_DBM) && (*Cr & DMA_SxCR_CT)) ? DMA_SxM1AR : DMA_SxM0AR);
+    if(*Cr & DMA_SxCR_MINC)
+    {
+        Memory += (DmaNumOfData[Stream] - *Ndtr) * Size;
+    }
+
+    if(Direction == DMA_DIR_MEM_TO_PERIPH)
+    {
+        memcpy(&Value, HostAddress(Memory), Size);
+        BusWrite(*DmaStreamReg(Stream, DMA_SxPAR), Value);
+    }
+    else if(Direction == DMA_DIR_PERIPH_TO_MEM)
+    {
+        Value = *Reg(*DmaStreamReg(Stream, DMA_SxPAR));
+        memcpy(HostAddress(Memory), &Value, Size);
+    }
+
+    (*Ndtr)--;
+    if(*Ndtr == (DmaNumOfData[Stream] / 2))
+    {
+        DmaSetFlags(Stream, DMA_FLAG_HTIF);
+    }
+    if(*Ndtr == 0)
+    {
+        DmaSetFlags(Stream, DMA_FLAG_TCIF);
+        if(*Cr & DMA_SxCR_DBM)
+        {
+            /* Switching to the other buffer */
+            *Cr ^= DMA_SxCR_CT;
+            *Ndtr = DmaNumOfData[Stream];
+        }
+        else if(*Cr & DMA_SxCR_CIRC)
+        {
+            *Ndtr = DmaNumOfData[Stream];
+        }
+        else
+        {
+            *Cr &= ~DMA_SxCR_EN;
+            DmaEnabled &= ~(1UL << Stream);
+        }
+    }
+    UpdateIrqs();
+}
+
+static void DmaWrite(uint32_t Offset, uint32_t Value)
+{
+    if((Offset == DMA_LIFCR) || (Offset == DMA_HIFCR))
+    {
+        /* Write one to clear, the clear registers read as zero */
+        DmaFlags[(Offset - DMA_LIFCR) / 4] &= ~Value;
+        *PeriphReg(SIM_PERIPH_DMA2, Offset) = 0;
+    }
+    else if((Offset >= DMA_STREAM(0)) && (Offset < DMA_STREAM(DMA_NUM_OF_STREAMS)) &&
+            (((Offset - DMA_STREAM(0)) % DMA_STREAM_SIZE) == DMA_SxCR))
+    {
+        uint32_t Stream = (Offset - DMA_STREAM(0)) / DMA_STREAM_SIZE;
+
+        /* The number of data is reloaded from the value NDTR had when the stream was enabled */
+        if((Value & DMA_SxCR_EN) && !(DmaEnabled & (1UL << Stream)))
+        {
+            DmaNumOfData[Stream] = *DmaStreamReg(Stream, DMA_SxNDTR);
+        }
+        DmaEnabled = (Value & DMA_SxCR_EN) ? (DmaEnabled | (1UL << Stream)) : (DmaEnabled & ~(1UL << Stream));
+    }
+
+    /* The status registers are read-only */
+    *PeriphReg(SIM_PERIPH_DMA2, DMA_LISR) = DmaFlags[0];
+    *PeriphReg(SIM_PERIPH_DMA2, DMA_HISR) = DmaFlags[1];
+    UpdateIrqs();
+}
+
+static void GpioWrite(uint32_t Offset, uint32_t Value)
+{
+    Sim_Peripheral_t Port = (Sim_Peripheral_t)CurrentPeriph;
+
+    if(Offset == GPIO_BSRR)
+    {
+        /* Set has priority over reset, BSRR always reads as zero */
+        uint32_t *Odr = PeriphReg(Port, GPIO_ODR);
+        *Odr = ((*Odr & ~(Value >> 16)) | Value) & 0xFFFFUL;
+        *PeriphReg(Port, GPIO_BSRR) = 0;
+    }
+    UpdateIdr(Port);
+}
+
+static void RccWrite(uint32_t Offset, uint32_t Value)
+{
+    (void)Value;
+
+    if(Offset == RCC_CR)
+    {
+        /* Each oscillator is ready as soon as it is turned on */
+        uint32_t *Cr = PeriphReg(SIM_PERIPH_RCC, RCC_CR);
+        *Cr = (*Cr & ~(RCC_CR_ON_MASK << 1)) | ((*Cr & RCC_CR_ON_MASK) << 1);
+    }
+    else if(Offset == RCC_CFGR)
+    {
+        /* The switch to the selected system clock is immediate */
+        uint32_t *Cfgr = PeriphReg(SIM_PERIPH_RCC, RCC_CFGR);
+        *Cfgr = (*Cfgr & ~(RCC_CFGR_SW_MASK << 2)) | ((*Cfgr & RCC_CFGR_SW_MASK) << 2);
+    }
+}
+
+static void SysTickRead(uint32_t Offset, uint32_t Value)
+{
+    (void)Value;
+
+    /* COUNTFLAG is cleared by reading CTRL */
+    if(Offset == SYSTICK_CTRL)
+    {
+        SysTickCountFlag = 0;
+        *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_CTRL) &= ~SYSTICK_CTRL_COUNTFLAG;
+    }
+}
+
+static void SysTickWrite(uint32_t Offset, uint32_t Value)
+{
+    switch(Offset)
+    {
+        case SYSTICK_CTRL:
+            *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_CTRL) = (Value & SYSTICK_CTRL_RW_MASK) | (SysTickCountFlag ? SYSTICK_CTRL_COUNTFLAG : 0);
+            break;
+        case SYSTICK_LOAD:
+            *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_LOAD) = Value & SYSTICK_MAX_RELOAD;
+            break;
+        case SYSTICK_VAL:
+            /* Any write clears the counter and COUNTFLAG, the next count reloads it */
+            *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_VAL) = 0;
+            *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_CTRL) &= ~SYSTICK_CTRL_COUNTFLAG;
+            SysTickCountFlag = 0;
+            SysTickPhase = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+static void NvicWrite(uint32_t Offset, uint32_t Value)
+{
+    uint32_t Word = (Offset % NVIC_BANK_SIZE) / 4;
+    uint32_t Bank = Offset - (Offset % NVIC_BANK_SIZE);
+
+    if((Offset >= (NVIC_ICPR + NVIC_BANK_SIZE)) || (Word >= NVIC_NUM_OF_WORDS))
+    {
+        return;
+    }
+
+    switch(Bank)
+    {
+        case NVIC_ISER: NvicEnabled[Word] |= Value;  break;
+        case NVIC_ICER: NvicEnabled[Word] &= ~Value; break;
+        case NVIC_ISPR: NvicPending[Word] |= Value;  break;
+        case NVIC_ICPR: NvicPending[Word] &= ~Value; break;
+        default: break;
+    }
+
+    /* Set and clear registers both read back the current state */
+    *PeriphReg(SIM_PERIPH_NVIC, NVIC_ISER + (Word * 4)) = NvicEnabled[Word];
+    *PeriphReg(SIM_PERIPH_NVIC, NVIC_ICER + (Word * 4)) = NvicEnabled[Word];
+    *PeriphReg(SIM_PERIPH_NVIC, NVIC_ISPR + (Word * 4)) = NvicPending[Word];
+    *PeriphReg(SIM_PERIPH_NVIC, NVIC_ICPR + (Word * 4)) = NvicPending[Word];
+
+    /* Clearing the pending state of an interrupt does not clear the request of its peripheral */
+    UpdateIrqs();
+}
+
+/* Cycles until the counter next reaches zero, UINT64_MAX when it is stopped */
+static uint64_t CyclesToSysTickEvent(void)
+{
+    uint32_t Ctrl = *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_CTRL);
+    uint32_t Load = *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_LOAD);
+    uint32_t Val = *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_VAL);
+    uint64_t Divider = (Ctrl & SYSTICK_CTRL_CLKSOURCE) ? 1 : 8;
+    uint64_t Counts;
+
+    if(!(Ctrl & SYSTICK_CTRL_ENABLE) || (Load == 0))
+    {
+        return UINT64_MAX;
+    }
+
+    Counts = Val ? Val : ((uint64_t)Load + 1);
+    return (Counts * Divider) - SysTickPhase;
+}
+
+static void SysTickAdvance(uint64_t Cycles)
+{
+    uint32_t *Ctrl = PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_CTRL);
+    uint32_t *Val = PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_VAL);
+    uint32_t Load = *PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_LOAD);
+    uint64_t Divider = (*Ctrl & SYSTICK_CTRL_CLKSOURCE) ? 1 : 8;
+    uint64_t Counts;
+
+    if(!(*Ctrl & SYSTICK_CTRL_ENABLE) || (Load == 0))
+    {
+        return;
+    }
+
+    Counts = (SysTickPhase + Cycles) / Divider;
+    SysTickPhase = (uint32_t)((SysTickPhase + Cycles) % Divider);
+    while(Counts)
+    {
+        if(*Val == 0)
+        {
+            *Val = Load;
+            Counts--;
+        }
+        else if(Counts >= *Val)
+        {
+            Counts -= *Val;
+            *Val = 0;
+            SysTickCountFlag = 1;
+            *Ctrl |= SYSTICK_CTRL_COUNTFLAG;
+            if(*Ctrl & SYSTICK_CTRL_TICKINT)
+            {
+                SysTickPending = 1;
+            }
+        }
+        else
+        {
+            *Val -= (uint32_t)Counts;
+            Counts = 0;
+        }
+    }
+}
+
+static void TakePendingInterrupts(void)
+{
+    /* No nesting, a single priority level is modelled */
+    if(Primask || InHandler)
+    {
+        return;
+    }
+
+    while(IsInterruptPending())
+    {
+        InHandler = 1;
+        if(SysTickPending)
+        {
+            SysTickPending = 0;
+            if(SysTick_Handler)
+            {
+                SysTick_Handler();
+            }
+        }
+        else
+        {
+            /* Lowest IRQ number first */
+            uint32_t Irq = 0;
+            while(!(NvicPending[Irq / 32] & NvicEnabled[Irq / 32] & (1UL << (Irq % 32))))
+            {
+                Irq++;
+            }
+            NvicPending[Irq / 32] &= ~(1UL << (Irq % 32));
+            *PeriphReg(SIM_PERIPH_NVIC, NVIC_ISPR + ((Irq / 32) * 4)) = NvicPending[Irq / 32];
+            *PeriphReg(SIM_PERIPH_NVIC, NVIC_ICPR + ((Irq / 32) * 4)) = NvicPending[Irq / 32];
+            if((Irq < (sizeof(IrqHandlers) / sizeof(IrqHandlers[0]))) && IrqHandlers[Irq])
+            {
+                IrqHandlers[Irq]();
+            }
+            /* A request left pending by the handler triggers the interrupt again */
+            UpdateIrqs();
+        }
+        InHandler = 0;
+        TakenInterrupts++;
+    }
+}
+
+static uint32_t IsInterruptPending(void)
+{
+    uint32_t Word;
+
+    if(SysTickPending)
+    {
+        return 1;
+    }
+    for(Word = 0; Word < NVIC_NUM_OF_WORDS; Word++)
+    {
+        if(NvicPending[Word] & NvicEnabled[Word])
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void CheckTimeLimit(void)
+{
+    if(NowCycles < LimitCycles)
+    {
+        return;
+    }
+
+    if(RunExit)
+    {
+        longjmp(*RunExit, 1);
+    }
+
+    /* The firmware runs from its own main(), which never returns */
+    printf("Simulated %llu ms\n", (unsigned long long)(NowCycles / (SIM_CORE_CLOCK_HZ / 1000UL)));
+    Sim_printAccessCounts();
+    exit(EXIT_SUCCESS);
+}
+
+static void SegvHandler(int Signal, siginfo_t *Info, void *Context)
+{
+    ucontext_t *UContext = (ucontext_t *)Context;
+    uintptr_t Address = (uintptr_t)Info->si_addr;
+    PendingAccess_t *Access;
+
+    if((FindBlock(Address) == NULL) || (PendingCount == SIM_MAX_PENDING))
+    {
+        /* Not a register access, let the faulting instruction crash the program */
+        signal(Signal, SIG_DFL);
+        return;
+    }
+
+    Access = &Pending[PendingCount++];
+    Access->Page = Address & ~(SIM_PAGE_SIZE - 1);
+    Access->Address = (uint32_t)Address;
+    Access->IsWrite = (UContext->uc_mcontext.gregs[REG_ERR] & X86_PF_WRITE) ? 1 : 0;
+    Access->IsBitBand = IS_BITBAND_ALIAS(Address) ? 1 : 0;
+    if(Access->IsBitBand)
+    {
+        /* The access is made to one bit of the register behind the alias word, a read returns that bit */
+        Access->AliasAddress = (uint32_t)Address;
+        Access->Bit = (uint32_t)((Address - BITBAND_ALIAS_BASE) / 4) % 32;
+        Access->Address = BITBAND_PERIPH_BASE + ((uint32_t)((Address - BITBAND_ALIAS_BASE) / 32) & ~3UL);
+        *Reg(Access->AliasAddress) = (*Reg(Access->Address) >> Access->Bit) & 1UL;
+    }
+    Access->Periph = FindPeriph(Access->Address);
+
+    if(Access->Periph != SIM_NO_PERIPH)
+    {
+        if(Access->IsWrite)
+        {
+            Periphs[Access->Periph].Count.Writes++;
+        }
+        else
+        {
+            Periphs[Access->Periph].Count.Reads++;
+        }
+    }
+
+    mprotect((void *)Access->Page, SIM_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    UContext->uc_mcontext.gregs[REG_EFL] |= X86_EFLAGS_TF;
+}
+
+static void TrapHandler(int Signal, siginfo_t *Info, void *Context)
+{
+    ucontext_t *UContext = (ucontext_t *)Context;
+    uint32_t Count = PendingCount;
+    uint32_t idx;
+
+    (void)Info;
+    if(Counting == SIM_COUNT_RUNNING)
+    {
+        /* Stepping through every instruction, the trap flag stays set */
+        InstructionCount++;
+    }
+    else if(Counting == SIM_COUNT_STOPPING)
+    {
+        Counting = SIM_COUNT_OFF;
+        UContext->uc_mcontext.gregs[REG_EFL] &= ~X86_EFLAGS_TF;
+    }
+    else if(Count == 0)
+    {
+        signal(Signal, SIG_DFL);
+        raise(Signal);
+        return;
+    }
+    else
+    {
+        UContext->uc_mcontext.gregs[REG_EFL] &= ~X86_EFLAGS_TF;
+    }
+
+    for(idx = 0; idx < Count; idx++)
+    {
+        mprotect((void *)Pending[idx].Page, SIM_PAGE_SIZE, PROT_NONE);
+    }
+
+    for(idx = 0; idx < Count; idx++)
+    {
+        PendingAccess_t const *Access = &Pending[idx];
+        Periph_t const *Periph;
+
+        if(Access->Periph == SIM_NO_PERIPH)
+        {
+            continue;
+        }
+        Periph = &Periphs[Access->Periph];
+        CurrentPeriph = Access->Periph;
+        if(Access->IsBitBand && Access->IsWrite)
+        {
+            uint32_t *Target = Reg(Access->Address);
+            *Target = (*Target & ~(1UL << Access->Bit)) | ((*Reg(Access->AliasAddress) & 1UL) << Access->Bit);
+        }
+        if(Access->IsWrite && Periph->WriteHook)
+        {
+            Periph->WriteHook((Access->Address & ~3UL) - Periph->Base, *Reg(Access->Address));
+        }
+        else if(!Access->IsWrite && Periph->ReadHook)
+        {
+            Periph->ReadHook((Access->Address & ~3UL) - Periph->Base, *Reg(Access->Address));
+        }
+    }
+    PendingCount = 0;
+}
+
+void Sim_init(void)
+{
+    static uint32_t IsMapped;
+    struct sigaction Action;
+    uint32_t idx;
+
+    if(!IsMapped)
+    {
+        for(idx = 0; idx < (sizeof(Blocks) / sizeof(Blocks[0])); idx++)
+        {
+            Block_t *Block = &Blocks[idx];
+            int Fd = memfd_create("sim-registers", 0);
+
+            if((Fd < 0) || (ftruncate(Fd, Block->Size) != 0))
+            {
+                perror("sim: memfd");
+                exit(EXIT_FAILURE);
+            }
+            Block->Alias = mmap(NULL, Block->Size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+            if((Block->Alias == MAP_FAILED) ||
+               (mmap((void *)(uintptr_t)Block->Base, Block->Size, PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, Fd, 0) != (void *)(uintptr_t)Block->Base))
+            {
+                fprintf(stderr, "sim: can not map the registers at 0x%08X\n", Block->Base);
+                exit(EXIT_FAILURE);
+            }
+            close(Fd);
+        }
+
+        memset(&Action, 0, sizeof(Action));
+        Action.sa_flags = SA_SIGINFO;
+        sigemptyset(&Action.sa_mask);
+        Action.sa_sigaction = SegvHandler;
+        sigaction(SIGSEGV, &Action, NULL);
+        Action.sa_sigaction = TrapHandler;
+        sigaction(SIGTRAP, &Action, NULL);
+        IsMapped = 1;
+    }
+
+    LoadResetValues();
+    memset(PinInputs, 0, sizeof(PinInputs));
+    memset(NvicEnabled, 0, sizeof(NvicEnabled));
+    memset(NvicPending, 0, sizeof(NvicPending));
+    ExtiPending = 0;
+    TimCycles = 0;
+    TimStatus = 0;
+    memset(DmaFlags, 0, sizeof(DmaFlags));
+    DmaEnabled = 0;
+    memset(DmaNumOfData, 0, sizeof(DmaNumOfData));
+    for(idx = 0; idx < _SIM_NUM_OF_PERIPHS; idx++)
+    {
+        Periphs[idx].ReadHook = DefaultReadHooks[idx];
+        Periphs[idx].WriteHook = DefaultWriteHooks[idx];
+    }
+    Sim_resetAccessCounts();
+
+    NowCycles = 0;
+    LimitCycles = UINT64_MAX;
+    Primask = 0;
+    SysTickPending = 0;
+    SysTickCountFlag = 0;
+    SysTickPhase = 0;
+    InHandler = 0;
+    TakenInterrupts = 0;
+}
+
+__attribute__((constructor)) static void SimAutoInit(void)
+{
+    const char *Duration = getenv("SIM_DURATION_MS");
+    uint64_t DurationMS = Duration ? strtoull(Duration, NULL, 10) : SIM_DEFAULT_DURATION_MS;
+
+    Sim_init();
+    LimitCycles = DurationMS * (SIM_CORE_CLOCK_HZ / 1000UL);
+}
+
+uint64_t Sim_run(void (*Entry)(void), uint32_t DurationMS)
+{
+    jmp_buf Exit;
+    jmp_buf *PreviousExit = RunExit;
+    uint64_t PreviousLimit = LimitCycles;
+    uint64_t Start = NowCycles;
+
+    LimitCycles = NowCycles + ((uint64_t)DurationMS * (SIM_CORE_CLOCK_HZ / 1000UL));
+    RunExit = &Exit;
+    if(setjmp(Exit) == 0)
+    {
+        Entry();
+    }
+
+    /* Left in the middle of the firmware, possibly with interrupts masked */
+    Primask = 0;
+    InHandler = 0;
+    RunExit = PreviousExit;
+    LimitCycles = PreviousLimit;
+
+    return NowCycles - Start;
+}
+
+void Sim_getAccessCount(Sim_Peripheral_t Peripheral, Sim_AccessCount_t *Count)
+{
+    *Count = Periphs[Peripheral].Count;
+}
+
+void Sim_resetAccessCounts(void)
+{
+    uint32_t idx;
+    for(idx = 0; idx < _SIM_NUM_OF_PERIPHS; idx++)
+    {
+        Periphs[idx].Count.Reads = 0;
+        Periphs[idx].Count.Writes = 0;
+    }
+}
+
+void Sim_printAccessCounts(void)
+{
+    uint32_t idx;
+
+    printf("%-10s %12s %12s\n", "Peripheral", "Reads", "Writes");
+    for(idx = 0; idx < _SIM_NUM_OF_PERIPHS; idx++)
+    {
+        if(Periphs[idx].Count.Reads || Periphs[idx].Count.Writes)
+        {
+            printf("%-10s %12llu %12llu\n", Periphs[idx].Name,
+                   (unsigned long long)Periphs[idx].Count.Reads, (unsigned long long)Periphs[idx].Count.Writes);
+        }
+    }
+}
+
+const char *Sim_getPeripheralName(Sim_Peripheral_t Peripheral)
+{
+    return Periphs[Peripheral].Name;
+}
+
+void Sim_setReadHook(Sim_Peripheral_t Peripheral, Sim_AccessHook_t Hook)
+{
+    Periphs[Peripheral].ReadHook = Hook;
+}
+
+void Sim_setWriteHook(Sim_Peripheral_t Peripheral, Sim_AccessHook_t Hook)
+{
+    Periphs[Peripheral].WriteHook = Hook;
+}
+
+uint32_t Sim_peekRegister(uint32_t Address)
+{
+    return *Reg(Address);
+}
+
+void Sim_pokeRegister(uint32_t Address, uint32_t Value)
+{
+    *Reg(Address) = Value;
+}
+
+void Sim_setPinInput(Sim_Peripheral_t Port, uint32_t Pin, uint32_t Level)
+{
+    if(!IS_GPIO_PERIPH(Port) || (Pin >= 16))
+    {
+        return;
+    }
+
+    PinInputs[Port] = Level ? (PinInputs[Port] | (1UL << Pin)) : (PinInputs[Port] & ~(1UL << Pin));
+    UpdateIdr(Port);
+    TakePendingInterrupts();
+}
+
+uint64_t Sim_getTimeCycles(void)
+{
+    return NowCycles;
+}
+
+void Sim_advanceCycles(uint64_t Cycles)
+{
+    while(Cycles)
+    {
+        uint64_t Step = CyclesToSysTickEvent();
+        uint64_t TimStep = CyclesToTimEvent();
+
+        Step = (Step < TimStep) ? Step : TimStep;
+        Step = (Step < Cycles) ? Step : Cycles;
+        Step = (Step < (LimitCycles - NowCycles)) ? Step : (LimitCycles - NowCycles);
+
+        SysTickAdvance(Step);
+        TimAdvance(Step);
+        NowCycles += Step;
+        Cycles -= Step;
+
+        TakePendingInterrupts();
+        CheckTimeLimit();
+    }
+}
+
+void Sim_idle(void)
+{
+    Sim_waitForInterrupt();
+}
+
+void Sim_disableIrq(void)
+{
+    Primask = 1;
+}
+
+void Sim_enableIrq(void)
+{
+    Primask = 0;
+    TakePendingInterrupts();
+}
+
+void Sim_waitForInterrupt(void)
+{
+    uint64_t Taken = TakenInterrupts;
+
+    /* Going from one timer event to the next until one of them raises an interrupt */
+    while(!IsInterruptPending() && (TakenInterrupts == Taken))
+    {
+        uint64_t Step = CyclesToSysTickEvent();
+        uint64_t TimStep = CyclesToTimEvent();
+
+        Step = (Step < TimStep) ? Step : TimStep;
+        if((Step == UINT64_MAX) ||
+           (!(*PeriphReg(SIM_PERIPH_SYSTICK, SYSTICK_CTRL) & SYSTICK_CTRL_TICKINT) && (TimStep == UINT64_MAX)))
+        {
+            /* Sleeping forever when nothing can wake the core, until the end of the simulation */
+            Step = LimitCycles - NowCycles;
+        }
+        Sim_advanceCycles(Step ? Step : 1);
+    }
+    TakePendingInterrupts();
+}
+
+void Sim_startInstructionCount(void)
+{
+    InstructionCount = 0;
+    Counting = SIM_COUNT_RUNNING;
+
+    /* Setting the trap flag, every following instruction raises SIGTRAP */
+    __asm volatile ("pushfq\n\torq $0x100, (%%rsp)\n\tpopfq" : : : "memory", "cc");
+}
+
+uint64_t Sim_stopInstructionCount(void)
+{
+    uint64_t Count = InstructionCount;
+
+    /* The trap following this store clears the trap flag */
+    Counting = SIM_COUNT_STOPPING;
+    return Count;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file Sim.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Simulated register backend of the host (Linux) build.
+ * @version 0.1
+ * @date 2024-04-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * The peripheral register blocks are backed by RAM images mapped at their real addresses,
+ * so the MCAL drivers run unmodified. The images are kept inaccessible: every access faults,
+ * is counted per peripheral, then single-stepped with the page unlocked, which lets the
+ * backend model the side effects of the access (RCC ready flags, GPIO BSRR, SysTick...).
+ *
+ * Simulated time only advances when the firmware waits (CPU_WAIT_FOR_INTERRUPT(),
+ * CPU_IDLE_HOOK()) or when Sim_advanceCycles() is called, SysTick interrupts are raised
+ * accordingly and honour CPU_DISABLE_IRQ()/CPU_ENABLE_IRQ().
+ *
+ * TIM1 counts on the core clock and its update events trigger the transfers of DMA2 Stream5
+ * (channel 6). The DMA reaches the firmware memory through the low 32 bits of its host address,
+ * so the buffers must be statically allocated. DMA transfers are not counted as register accesses.
+ *
+ * @note Requires an x86-64 Linux host (page protection and the trap flag are used).
+ */
+#ifndef HOST_SIM_SIM_H_
+#define HOST_SIM_SIM_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Frequency of the simulated core (HSI after reset).
+ */
+#define SIM_CORE_CLOCK_HZ 16000000UL
+
+/**
+ * @brief Simulated run time when the firmware runs from its own main(), overridden by the
+ *        SIM_DURATION_MS environment variable.
+ */
+#define SIM_DEFAULT_DURATION_MS 1000UL
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Simulated peripherals, register accesses are counted separately for each of them.
+ */
+typedef enum
+{
+    SIM_PERIPH_GPIOA,
+    SIM_PERIPH_GPIOB,
+    SIM_PERIPH_GPIOC,
+    SIM_PERIPH_GPIOD,
+    SIM_PERIPH_GPIOE,
+    SIM_PERIPH_GPIOH,
+    SIM_PERIPH_RCC,
+    SIM_PERIPH_SYSCFG,
+    SIM_PERIPH_EXTI,
+    SIM_PERIPH_TIM1,
+    SIM_PERIPH_DMA2,
+    SIM_PERIPH_SYSTICK,
+    SIM_PERIPH_NVIC,
+    SIM_PERIPH_SCB,
+    _SIM_NUM_OF_PERIPHS,    /**< Total number of simulated peripherals ^^DO NOT MODIFY^^ */
+} Sim_Peripheral_t;
+
+/**
+ * @brief Register access counters of a peripheral.
+ */
+typedef struct
+{
+    uint64_t Reads;     /**< Number of register reads */
+    uint64_t Writes;    /**< Number of register writes */
+} Sim_AccessCount_t;
+
+/**
+ * @brief Hook modelling the side effect of a register access.
+ *
+ * @param Offset Offset of the accessed register from the peripheral base address.
+ * @param Value Value written, or value that was read.
+ */
+typedef void (*Sim_AccessHook_t)(uint32_t Offset, uint32_t Value);
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Maps the register images, loads their reset values and installs the access handlers.
+ *
+ * Called automatically before main(), calling it again resets the simulation.
+ */
+void Sim_init(void);
+
+/**
+ * @brief Runs @p Entry for @p DurationMS of simulated time.
+ *
+ * @p Entry may never return (Sched_start()), it is left once the simulated time is over.
+ *
+ * @return The simulated time that elapsed, in core cycles.
+ */
+uint64_t Sim_run(void (*Entry)(void), uint32_t DurationMS);
+
+/**
+ * @brief Retrieves the register access counters of a peripheral.
+ */
+void Sim_getAccessCount(Sim_Peripheral_t Peripheral, Sim_AccessCount_t *Count);
+
+/**
+ * @brief Clears the register access counters of all the peripherals.
+ */
+void Sim_resetAccessCounts(void);
+
+/**
+ * @brief Prints the register access counters of the accessed peripherals on stdout.
+ */
+void Sim_printAccessCounts(void);
+
+/**
+ * @brief Retrieves the name of a peripheral, e.g. "GPIOA".
+ */
+const char *Sim_getPeripheralName(Sim_Peripheral_t Peripheral);
+
+/**
+ * @brief Sets the hook called after each read of a peripheral register, NULL to remove it.
+ */
+void Sim_setReadHook(Sim_Peripheral_t Peripheral, Sim_AccessHook_t Hook);
+
+/**
+ * @brief Sets the hook called after each write of a peripheral register, NULL to remove it.
+ *
+ * Replaces the built-in model of the peripheral, if any.
+ */
+void Sim_setWriteHook(Sim_Peripheral_t Peripheral, Sim_AccessHook_t Hook);
+
+/**
+ * @brief Reads a register without counting the access nor triggering side effects.
+ */
+uint32_t Sim_peekRegister(uint32_t Address);
+
+/**
+ * @brief Writes a register without counting the access nor triggering side effects.
+ */
+void Sim_pokeRegister(uint32_t Address, uint32_t Value);
+
+/**
+ * @brief Drives an input pin from outside the chip, reflected in IDR when the pin is not an output.
+ *
+ * An edge selected on the EXTI line of the pin triggers its interrupt before returning.
+ */
+void Sim_setPinInput(Sim_Peripheral_t Port, uint32_t Pin, uint32_t Level);
+
+/**
+ * @brief Retrieves the simulated time in core cycles.
+ */
+uint64_t Sim_getTimeCycles(void);
+
+/**
+ * @brief Advances the simulated time, raising the interrupts that become due.
+ */
+void Sim_advanceCycles(uint64_t Cycles);
+
+/**
+ * @brief Advances the simulated time up to the next interrupt, used by CPU_IDLE_HOOK().
+ */
+void Sim_idle(void);
+
+/**
+ * @brief Simulated "cpsid i".
+ */
+void Sim_disableIrq(void);
+
+/**
+ * @brief Simulated "cpsie i", pending interrupts are taken immediately.
+ */
+void Sim_enableIrq(void);
+
+/**
+ * @brief Simulated "wfi", returns once an interrupt is pending even if interrupts are masked.
+ */
+void Sim_waitForInterrupt(void);
+
+/**
+ * @brief Starts counting the host instructions executed by the calling thread, single-stepping each of them.
+ *
+ * Used by the benchmarks to compare code paths, the count includes a constant overhead of the
+ * start/stop calls that can be measured with an empty section.
+ */
+void Sim_startInstructionCount(void);
+
+/**
+ * @brief Stops counting instructions.
+ *
+ * @return The number of instructions executed since Sim_startInstructionCount().
+ */
+uint64_t Sim_stopInstructionCount(void);
+
+
+#endif // HOST_SIM_SIM_H_
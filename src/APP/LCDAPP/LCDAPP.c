@@ -14,8 +14,14 @@
 /********************************************************************************************************/
 #include "LCDAPP.h"
 #include "HAL/LCD/LCD.h"
+#include "Services/Coroutine/Coroutine.h"
 
 
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define LCDAPP_DISPLAY_TIMEMS 5000UL
+
 /********************************************************************************************************/
 /************************************************Types***************************************************/
 /********************************************************************************************************/
@@ -24,56 +30,25 @@
 /********************************************************************************************************/
 /************************************************Variables***********************************************/
 /********************************************************************************************************/
-uint32_t MyTime = 0;
+static Co_t LCDAPP_Co = CO_INIT;
 
 /********************************************************************************************************/
-/*********************************************APIs Implementation****************************************/
+/*****************************************Static Functions Prototype*************************************/
 /********************************************************************************************************/
 
 
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
 /* Called every 100MS*/
 void LCDAPP_task(void)
 {
-    static uint32_t states = 0;
-    switch(states)
-    {
-        case 0:
-        {
-            LCD_setCursorPositionAsync(LCD1, 0, 5);
-            MyTime = 0;            
-            states++;
-
-            break;
-        }
-        case 1:
-        {
-            if((LCD_getState(LCD1) == LCD_STATE_READY))
-            {
-                MyTime = 0;
-                states++;
-            }
-            
-            break;
-        }
-        case 2:
-        {
-            LCD_writeStringAsync(LCD1, "Ziad", 4);
-            states++;
-            MyTime = 0;
-            break;
-        }
-        case 3:
-        {
+    CO_BEGIN(&LCDAPP_Co);
 
-            if((LCD_getState(LCD1) == LCD_STATE_READY) && (MyTime >= 50))
-            {
-                states = 0;
-                MyTime = 0;
-            }
-            break;
-        }
-    
-    }
+    /* Only the first cycle reaches the display, the text does not change afterwards */
+    LCD_writeFrameBuffer(LCD1, 0, 5, "Ziad", 4);
+    CO_SLEEP_MS(&LCDAPP_Co, LCDAPP_DISPLAY_TIMEMS);
 
-    MyTime++;
+    CO_END(&LCDAPP_Co);
 }
\ No newline at end of file
@@ -44,14 +44,7 @@
 
 static void ToggleGreenLed(void)
 {
-    static int tog = 1;
-    if(tog)
-          LED_setLedState(LED_GREEN, LED_ON);
-    else
-          LED_setLedState(LED_GREEN, LED_OFF);
-
-    tog ^= 1;
-   
+    LED_toggleLedFast(LED_GREEN);
 }
 void SwitchToggle_task(void)
 {
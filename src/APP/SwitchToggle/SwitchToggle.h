@@ -21,7 +21,7 @@
 
 
 
-void SwitchToggle_task(void)
+void SwitchToggle_task(void);
 
 
 
@@ -13,56 +13,47 @@
 /********************************************************************************************************/
 #include "TrafficLight.h"
 #include "HAL/Led/Led.h"
+#include "Services/Coroutine/Coroutine.h"
 
 
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+static Co_t TrafficLight_Co = CO_INIT;
 
 
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static void SetLights(LED_State_t Green, LED_State_t Yellow, LED_State_t Red);
+
 
 /********************************************************************************************************/
 /*********************************************APIs Implementation****************************************/
 /********************************************************************************************************/
 
+static void SetLights(LED_State_t Green, LED_State_t Yellow, LED_State_t Red)
+{
+    LED_setLedStateFast(LED_GREEN, Green);
+    LED_setLedStateFast(LED_YELLOW, Yellow);
+    LED_setLedStateFast(LED_RED, Red);
+}
 
-
+/* Each light stays on for one periodicity of the task */
 void TrafficLight_task(void)
 {
-    static int state = 0;
-    static int prev = 0;
-    
-    switch(state)
-    {
-        case 0:
-            LED_setLedState(LED_GREEN, LED_ON);
-            LED_setLedState(LED_YELLOW, LED_OFF);
-            LED_setLedState(LED_RED, LED_OFF);
-            prev = state;
-            state++;
-            break;
+    CO_BEGIN(&TrafficLight_Co);
+
+    SetLights(LED_ON, LED_OFF, LED_OFF);
+    CO_YIELD(&TrafficLight_Co);
 
-        case 1:
+    SetLights(LED_OFF, LED_ON, LED_OFF);
+    CO_YIELD(&TrafficLight_Co);
 
-            LED_setLedState(LED_GREEN, LED_OFF);
-            LED_setLedState(LED_YELLOW, LED_ON);
-            LED_setLedState(LED_RED, LED_OFF);
-            if(prev == 0)
-            {
-                state++;  
-            }
-            else
-            {
-                prev = state;
-                state--;
-            }
-            break;        
-        case 2:
-            LED_setLedState(LED_GREEN, LED_OFF);
-            LED_setLedState(LED_YELLOW, LED_OFF);
-            LED_setLedState(LED_RED, LED_ON);
-            prev = state;
-            state--; 
-            break; 
-    }
-    
+    SetLights(LED_OFF, LED_OFF, LED_ON);
+    CO_YIELD(&TrafficLight_Co);
 
+    SetLights(LED_OFF, LED_ON, LED_OFF);
 
+    CO_END(&TrafficLight_Co);
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**
+ * @file Board.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Implementation of the board initialization
+ * @version 0.1
+ * @date 2024-04-08
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "Board.h"
+#include "MCAL/RCC/RCC.h"
+#include "assertparam.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define NUM_OF_GPIOS 6UL
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+
+/* Clock of each GPIO port, indexed by GPIO_Port_t */
+static const RCC_AHB1PeripeheralTypeDef PortClocks[NUM_OF_GPIOS] =
+{
+    [GPIO_GPIOA] = RCC_AHB1PERIPHERAL_GPIOA,
+    [GPIO_GPIOB] = RCC_AHB1PERIPHERAL_GPIOB,
+    [GPIO_GPIOC] = RCC_AHB1PERIPHERAL_GPIOC,
+    [GPIO_GPIOD] = RCC_AHB1PERIPHERAL_GPIOD,
+    [GPIO_GPIOE] = RCC_AHB1PERIPHERAL_GPIOE,
+    [GPIO_GPIOH] = RCC_AHB1PERIPHERAL_GPIOH,
+};
+
+/* Kept out of the stack, only used during the startup */
+static GPIO_PinConfig_t PinConfigs[BOARD_MAX_PINS];
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+Board_Error_t Board_init(void)
+{
+    uint32_t NumOfPins = 0;
+    uint32_t UsedPorts = 0;
+    uint32_t idx;
+
+    /* Gathering the pins of all the modules */
+    for(idx = 0; idx < (uint32_t)_NUM_OF_PIN_SOURCES; idx++)
+    {
+        assert_param(Board_PinSources[idx]);
+
+        NumOfPins += Board_PinSources[idx](&PinConfigs[NumOfPins], BOARD_MAX_PINS - NumOfPins);
+        if(NumOfPins > BOARD_MAX_PINS)
+        {
+            return BOARD_NOK;
+        }
+    }
+
+    /* The port clocks must run before their registers are written */
+    for(idx = 0; idx < NumOfPins; idx++)
+    {
+        if((uint32_t)PinConfigs[idx].Port < NUM_OF_GPIOS)
+        {
+            UsedPorts |= 1UL << PinConfigs[idx].Port;
+        }
+    }
+    for(idx = 0; idx < NUM_OF_GPIOS; idx++)
+    {
+        if(UsedPorts & (1UL << idx))
+        {
+            RCC_enableAHB1Peripheral(PortClocks[idx]);
+        }
+    }
+
+    if(GPIO_initPins(PinConfigs, NumOfPins) != MCAL_OK)
+    {
+        return BOARD_NOK;
+    }
+
+    return BOARD_OK;
+}
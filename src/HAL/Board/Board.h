@@ -0,0 +1,69 @@
+/**
+ * @file Board.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Header file for the board initialization
+ * @version 0.1
+ * @date 2024-04-08
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef HAL_BOARD_BOARD_H_
+#define HAL_BOARD_BOARD_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "Board_cfg.h"
+#include "MCAL/GPIO/GPIO.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enumeration for Board-related errors.
+ */
+typedef enum
+{
+    BOARD_OK,      /**< Operation successful */
+    BOARD_NOK      /**< Operation not successful */
+} Board_Error_t;
+
+/**
+ * @brief Function listing the pin configurations of a HAL module (e.g. LED_getPinConfigs).
+ * 
+ * @param PinConfigs Array receiving the configurations.
+ * @param MaxPins Size of PinConfigs, the configurations that do not fit are not written.
+ * @return The number of pin configurations of the module.
+ */
+typedef uint32_t (*Board_PinSource_t)(GPIO_PinConfig_t *PinConfigs, uint32_t MaxPins);
+
+/** Array of the modules whose pins are configured by Board_init(). */
+extern const Board_PinSource_t Board_PinSources[_NUM_OF_PIN_SOURCES];
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enables the clock of the GPIO ports used and configures the pins of all the modules in Board_PinSources.
+ * 
+ * All the pin configurations are gathered first and applied with a single GPIO_initPins() call, so each
+ * configuration register of a port is written once however many modules share it.
+ * 
+ * @note Must be called before the init function of the HAL modules.
+ * @return BOARD_NOK if the pins do not fit in BOARD_MAX_PINS or GPIO_initPins() rejects them, BOARD_OK otherwise.
+ */
+Board_Error_t Board_init(void);
+
+
+#endif // HAL_BOARD_BOARD_H_
@@ -0,0 +1,30 @@
+/**
+ * @file Board_cfg.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Source file for the board configuration (Edit it to your own need)
+ * @version 0.1
+ * @date 2024-04-08
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "Board.h"
+#include "HAL/LCD/LCD.h"
+#include "HAL/Led/Led.h"
+#include "HAL/Switch/Switch.h"
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+
+/* The LEDs (LED_getPinConfigs) and the switch (Switch_getPinConfigs) share GPIOA with the LCD on this board,
+ * LED_Init() and Switch_init() return an error when their pins are not listed here */
+const Board_PinSource_t Board_PinSources[_NUM_OF_PIN_SOURCES] =
+{
+    [BOARD_PINS_LCD] = LCD_getPinConfigs,
+};
@@ -0,0 +1,45 @@
+/**
+ * @file Board_cfg.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Header file for the board configuration (Edit it to your own need)
+ * @version 0.1
+ * @date 2024-04-08
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef HAL_BOARD_BOARD_CFG_H_
+#define HAL_BOARD_BOARD_CFG_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Maximum number of pins configured by Board_init().
+ */
+#define BOARD_MAX_PINS 32UL
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enumeration representing the HAL modules whose pins are configured by Board_init().
+ *
+ * @note It is important not to add values after '_NUM_OF_PIN_SOURCES' and not to remove it, as it is used for boundary checks.
+ */
+typedef enum
+{
+    BOARD_PINS_LCD,
+    _NUM_OF_PIN_SOURCES
+}PIN_SOURCES;
+
+
+#endif // HAL_BOARD_BOARD_CFG_H_
@@ -15,13 +15,38 @@
 #include "LCD.h"
 #include "LCD_Cfg.h"
 #include "MCAL/GPIO/GPIO.h"
+#include "MCAL/DWT/DWT.h"
+#include "Services/Scheduler/Scheduler.h"
 #include "assertparam.h"
+#include <stddef.h>
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
 /********************************************************************************************************/
 #define LCD_TIMEMS_WAKEUP 31UL
 #define LCD_TIMEMS_SEND   1UL
 #define LCD_TIMEMS_FUNCTIONSET 1UL
+
+/* Flag of AddressCounter while the data writes go to the CGRAM */
+#define LCD_ADDRESS_CGRAM 0x80U
+
+/* Busy flag in the value read from the data pins, D7 */
+#define LCD_BUSY_FLAG_8BIT (1U << 7)
+#define LCD_BUSY_FLAG_4BIT (1U << 3)
+
+/* Enable pulse width, covers the 360 ns data delay of the reads, and rest of the 1000 ns enable cycle */
+#define LCD_TIMENS_ENABLE_HIGH 450UL
+#define LCD_TIMENS_ENABLE_LOW  550UL
+
+/* Execution times of the instructions with the 270 kHz oscillator, a data write includes the
+   4 us address counter update */
+#define LCD_TIMENS_EXECUTE        37000UL
+#define LCD_TIMENS_EXECUTE_DATA   41000UL
+#define LCD_TIMENS_CLEAR_HOME     1520000UL
+
+#define LCD_WAIT_BUDGET_CYCLES DWT_NS_TO_CYCLES(LCD_WAIT_BUDGET_US * 1000UL)
+
+/* Ports the data pins of an LCD may span */
+#define LCD_BUS_MAX_PORTS  2UL
 /********************************************************************************************************/
 /************************************************Types***************************************************/
 /********************************************************************************************************/
@@ -44,6 +69,8 @@ typedef enum
     LCD_OPERATION_WRITE_STRING,
     LCD_OPERATION_SETCURSOR_POS, 
     LCD_OPERATION_CLEAR_SCREEN,   
+    LCD_OPERATION_COMMAND,
+    LCD_OPERATION_FLUSH,
 }
 OperationState_t;
 
@@ -60,11 +87,15 @@ InitStep_t;
 typedef enum
 {
     LCD_WRITELCD_READY,
-    LCD_WRITELCD_WRITEPINS_4BIT,
-    LCD_WRITELCD_TRIGGER,
-    LCD_WRITELCD_TRIGGER_4BIT,
+    LCD_WRITELCD_WAIT_BUSY,
 }WriteLCDState_t;
 
+typedef enum
+{
+    LCD_FLUSH_SET_ADDRESS,
+    LCD_FLUSH_WRITE_CELL,
+}FlushStep_t;
+
 typedef enum
 {
     GENERALSTATE_DONE,
@@ -73,23 +104,38 @@ typedef enum
 
 typedef struct
 {
-    uint8_t *Buffer;
-    uint32_t len;
-    uint32_t index;
-}StringRequest_t;
-
-typedef struct 
-{
+    FlushStep_t Step;
     uint8_t row;
     uint8_t col;
-}CursorPos;
+    uint8_t Data;
+}FlushRequest_t;
 
 typedef struct
 {
-    StringRequest_t StringRequest;
-    CursorPos       CursorPos;
+    uint32_t        StringIndex;
+    FlushRequest_t  Flush;
 }UserRequest_t;
 
+/* Data pins of an LCD located on the same port */
+typedef struct
+{
+    uint8_t            Port;
+    uint32_t volatile *BSRR;
+    uint32_t          *Words;                      /* BSRR word driving the pins to each bus value, in BusTables */
+    uint32_t           RSWords[2];                 /* RS bit of each SendType_t, 0 if RS is on another port */
+}BusPort_t;
+
+/* Ready-to-store BSRR words of the data bus, built once by PinsInit() */
+typedef struct
+{
+    uint32_t           NumOfPorts;
+    BusPort_t          Ports[LCD_BUS_MAX_PORTS];
+    uint32_t volatile *RSBSRR;                     /* Store of RS if it shares no port with the data pins, NULL otherwise */
+    uint32_t           RSWords[2];
+    uint32_t volatile *ENBSRR;
+    uint32_t           ENMask;
+}Bus_t;
+
 /********************************************************************************************************/
 /************************************************Variables***********************************************/
 /********************************************************************************************************/
@@ -98,8 +144,44 @@ static OperationState_t CurrentOperation[_NUM_OF_LCDS] = {LCD_OPERATION_NONE};
 static InitStep_t CurrentInitStep[_NUM_OF_LCDS] = {LCD_INIT_PINS};
 static WriteLCDState_t CurrentWriteCommandState[_NUM_OF_LCDS] = {LCD_WRITELCD_READY};
 static uint32_t elapsedTimeMS[_NUM_OF_LCDS] = {0};
+/* Set once the busy flag can be read, after the function set of an LCD with an RW pin */
+static uint8_t UseBusyFlag[_NUM_OF_LCDS] = {0};
+/* Cycle count at the start of the current LCD_task() call, and at which the controller is ready without the busy flag */
+static uint32_t TaskStartCycles[_NUM_OF_LCDS] = {0};
+static uint32_t ReadyCycles[_NUM_OF_LCDS] = {0};
 
 static UserRequest_t UserRequest[_NUM_OF_LCDS] = {0};
+static LCD_ReadyCallBack_t ReadyCallBack[_NUM_OF_LCDS] = {0};
+
+/* Ring of the queued requests, the one at QueueHead is being executed */
+static LCD_Request_t RequestQueue[_NUM_OF_LCDS][LCD_QUEUE_LENGTH];
+static uint8_t QueueHead[_NUM_OF_LCDS] = {0};
+static uint8_t QueueCount[_NUM_OF_LCDS] = {0};
+
+/* Operation executing each type of request */
+static const OperationState_t RequestOperation[] =
+{
+    [LCD_REQUEST_SET_CURSOR]   = LCD_OPERATION_SETCURSOR_POS,
+    [LCD_REQUEST_WRITE_STRING] = LCD_OPERATION_WRITE_STRING,
+    [LCD_REQUEST_CLEAR_SCREEN] = LCD_OPERATION_CLEAR_SCREEN,
+    [LCD_REQUEST_COMMAND]      = LCD_OPERATION_COMMAND,
+};
+static GPIO_PinGroup_t DataPins[_NUM_OF_LCDS];
+static Bus_t Buses[_NUM_OF_LCDS];
+
+/* Storage of the BSRR words of the data buses, each LCD takes what its data length and ports need */
+static uint32_t BusTables[LCD_BUS_TABLE_WORDS];
+static uint32_t BusTablesUsed = 0;
+
+/* Frame buffer written by the user, and the cells the display currently shows */
+static uint8_t FrameBuffer[_NUM_OF_LCDS][LCD_NUM_OF_ROWS][LCD_NUM_OF_COLS];
+static uint8_t DisplayedCells[_NUM_OF_LCDS][LCD_NUM_OF_ROWS][LCD_NUM_OF_COLS];
+static uint8_t FrameBufferDirty[_NUM_OF_LCDS] = {0};
+/* DDRAM address the next data write goes to */
+static uint8_t AddressCounter[_NUM_OF_LCDS] = {0};
+
+/* DDRAM address of the first column of each row */
+static const uint8_t RowAddress[4] = {0x00, 0x40, 0x14, 0x54};
 
 /********************************************************************************************************/
 /*****************************************Static Functions Prototype*************************************/
@@ -112,141 +194,428 @@ static void Init(LCD_ID ID);
 static void Operate(LCD_ID ID);
 
 /* Initialization functions */
-static void PinsInit(LCD_ID ID);
+static uint32_t PinsInit(LCD_ID ID);
+static uint32_t BusInit(LCD_ID ID);
 
 static void WriteLCD(LCD_ID LCD_ID, uint8_t Command, SendType_t SendType);
-static void WritePins(LCD_ID LCD_ID, uint8_t value);
+static void WriteBus(LCD_ID ID, uint8_t Value, SendType_t SendType);
+
+/* Busy flag functions */
+static void PulseEnable(LCD_ID ID);
+static void SendByte(LCD_ID ID, uint8_t Byte, SendType_t SendType);
+static uint32_t WaitNotBusy(LCD_ID ID);
+static uint32_t WaitUntil(LCD_ID ID, uint32_t Cycles);
+static uint32_t ExecutionCycles(uint8_t Command, SendType_t SendType);
+static uint32_t IsIdle(LCD_ID ID);
+static void NotifyReady(LCD_ID ID);
+
+/* Frame buffer functions */
+static uint8_t DDRAMAddress(uint8_t row, uint8_t col);
+static void TrackDataWrite(LCD_ID ID, uint8_t Data);
+static void TrackCommand(LCD_ID ID, uint8_t Command);
+static void BlankCells(uint8_t Cells[LCD_NUM_OF_ROWS][LCD_NUM_OF_COLS]);
+static uint32_t FlushNextCell(LCD_ID ID);
+
+/* Queue functions */
+static void StartNextOperation(LCD_ID ID);
+static void CompleteRequest(LCD_ID ID);
 /********************************************************************************************************/
 /*********************************************APIs Implementation****************************************/
 /********************************************************************************************************/
 
-static void WritePins(LCD_ID LCD_ID, uint8_t value)
+static void WriteBus(LCD_ID ID, uint8_t Value, SendType_t SendType)
 {
- 	LCD_Config_t const *CurrentLCD = &(LCD_Config[LCD_ID]);
+    Bus_t const *Bus = &Buses[ID];
+    uint32_t PortCounter;
 
-	GPIO_Port_t		    PortID;
-	GPIO_Pin_t		    PinNum;
-	GPIO_PinState_t    PinState;
+    /* A lookup and a store per port, RS rides along with the data pins of its port */
+    if(Bus->RSBSRR != NULL)
+    {
+        *Bus->RSBSRR = Bus->RSWords[SendType];
+    }
+    for(PortCounter = 0; PortCounter < Bus->NumOfPorts; PortCounter++)
+    {
+        BusPort_t const *Port = &Bus->Ports[PortCounter];
+        *Port->BSRR = Port->Words[Value] | Port->RSWords[SendType];
+    }
+}
+static void WriteLCD(LCD_ID LCD_ID, uint8_t Command, SendType_t SendType)
+{
+    uint32_t Ready = UseBusyFlag[LCD_ID] ? WaitNotBusy(LCD_ID) : WaitUntil(LCD_ID, ReadyCycles[LCD_ID]);
 
-	uint8_t LCDPinCounter = 0;
-	uint8_t NumOfPins = (CurrentLCD->DataLength == LCD_DL_8BIT) ? 8 : 4;
+    /* The whole byte is sent as soon as the controller is ready, otherwise the next call retries */
+    if(Ready)
+    {
+        SendByte(LCD_ID, Command, SendType);
+        ReadyCycles[LCD_ID] = DWT_getCycleCount() + ExecutionCycles(Command, SendType);
+        CurrentWriteCommandState[LCD_ID] = LCD_WRITELCD_READY;
+    }
+    else
+    {
+        CurrentWriteCommandState[LCD_ID] = LCD_WRITELCD_WAIT_BUSY;
+    }
+}
 
-	for(LCDPinCounter = 0; LCDPinCounter < NumOfPins; LCDPinCounter++)
-	{
-		PortID		= CurrentLCD->Pins[LCDPinCounter].PortID;
-		PinNum		= (GPIO_Pin_t)CurrentLCD->Pins[LCDPinCounter].PinNum;
-		PinState = (((value  >> LCDPinCounter) & 1 ) == 1) ? GPIO_PINSTATE_SET : GPIO_PINSTATE_RESET;
+static uint32_t ExecutionCycles(uint8_t Command, SendType_t SendType)
+{
+    if(SendType == LCD_SEND_DATA)
+    {
+        return DWT_NS_TO_CYCLES(LCD_TIMENS_EXECUTE_DATA);
+    }
 
-		GPIO_setPinValue(PortID, PinNum, PinState);	
-	}
-   
+    /* Clear display and return home */
+    if(Command < 0x04)
+    {
+        return DWT_NS_TO_CYCLES(LCD_TIMENS_CLEAR_HOME);
+    }
+
+    return DWT_NS_TO_CYCLES(LCD_TIMENS_EXECUTE);
 }
-static void WriteLCD(LCD_ID LCD_ID, uint8_t Command, SendType_t SendType)
+
+/**
+ * @brief Busy-waits until the cycle counter reaches Cycles, if that fits in the wait budget left
+ *        to the current LCD_task() call.
+ * @return 1 once Cycles is reached, 0 if the wait is left to a next call.
+ */
+static uint32_t WaitUntil(LCD_ID ID, uint32_t Cycles)
+{
+    uint32_t Now = DWT_getCycleCount();
+    uint32_t Remaining = Cycles - Now;
+    uint32_t Elapsed = Now - TaskStartCycles[ID];
+
+    /* No wait is longer than a clear, a larger difference is a time already past */
+    if((Remaining == 0) || (Remaining > DWT_NS_TO_CYCLES(LCD_TIMENS_CLEAR_HOME)))
+    {
+        return 1;
+    }
+
+    if((Elapsed >= LCD_WAIT_BUDGET_CYCLES) || (Remaining > (LCD_WAIT_BUDGET_CYCLES - Elapsed)))
+    {
+        return 0;
+    }
+
+    DWT_delayCycles(Remaining);
+    return 1;
+}
+
+static void PulseEnable(LCD_ID ID)
+{
+    Bus_t const *Bus = &Buses[ID];
+
+    /* EN gets its own stores, RS and data must settle before its rising edge and hold after its falling one */
+    *Bus->ENBSRR = Bus->ENMask;
+    DWT_delayCycles(DWT_NS_TO_CYCLES(LCD_TIMENS_ENABLE_HIGH));
+    *Bus->ENBSRR = Bus->ENMask << 16;
+    DWT_delayCycles(DWT_NS_TO_CYCLES(LCD_TIMENS_ENABLE_LOW));
+}
+
+static void SendByte(LCD_ID ID, uint8_t Byte, SendType_t SendType)
+{
+    LCD_Config_t const *CurrentLCD = &(LCD_Config[ID]);
+
+    if(CurrentLCD->DataLength == LCD_DL_8BIT)
+    {
+        WriteBus(ID, Byte, SendType);
+        PulseEnable(ID);
+    }
+    else
+    {
+        WriteBus(ID, Byte >> 4, SendType);
+        PulseEnable(ID);
+        WriteBus(ID, Byte & 0x0F, SendType);
+        PulseEnable(ID);
+    }
+}
+
+/**
+ * @brief Reads the busy flag until the controller is ready or the wait budget of the current LCD_task() call runs out.
+ * @return 1 if the controller is ready, 0 if it is still busy.
+ */
+static uint32_t WaitNotBusy(LCD_ID ID)
 {
-    LCD_Config_t const *CurrentLCD = &(LCD_Config[LCD_ID]);
+    LCD_Config_t const *CurrentLCD = &(LCD_Config[ID]);
+    GPIO_Port_t ENPortID = (GPIO_Port_t)CurrentLCD->EnablePin.PortID;
+    GPIO_Pin_t  ENPinNum = (GPIO_Pin_t)CurrentLCD->EnablePin.PinNum;
+    uint32_t BusyFlag = (CurrentLCD->DataLength == LCD_DL_8BIT) ? LCD_BUSY_FLAG_8BIT : LCD_BUSY_FLAG_4BIT;
+    uint32_t Status = BusyFlag;
 
-    GPIO_Port_t		RSPortID  = (GPIO_Port_t)CurrentLCD->RSPin.PortID;
-    GPIO_Pin_t		RSPinNum  = (GPIO_Pin_t)CurrentLCD->RSPin.PinNum;
-    GPIO_PinState_t RSPinState =  SendType; 
+    if((DWT_getCycleCount() - TaskStartCycles[ID]) >= LCD_WAIT_BUDGET_CYCLES)
+    {
+        return 0;
+    }
+
+    /* RS low and RW high: the controller drives the busy flag and address counter while EN is high */
+    GPIO_setPinGroupMode(&DataPins[ID], GPIO_MODE_INPUT_NOPULL);
+    GPIO_setPinValue((GPIO_Port_t)CurrentLCD->RSPin.PortID, (GPIO_Pin_t)CurrentLCD->RSPin.PinNum, GPIO_PINSTATE_RESET);
+    GPIO_setPinValue((GPIO_Port_t)CurrentLCD->RWPin.PortID, (GPIO_Pin_t)CurrentLCD->RWPin.PinNum, GPIO_PINSTATE_SET);
+
+    while((Status & BusyFlag) && ((DWT_getCycleCount() - TaskStartCycles[ID]) < LCD_WAIT_BUDGET_CYCLES))
+    {
+        GPIO_setPinValue(ENPortID, ENPinNum, GPIO_PINSTATE_SET);
+        DWT_delayCycles(DWT_NS_TO_CYCLES(LCD_TIMENS_ENABLE_HIGH));
+        Status = GPIO_readPinGroup(&DataPins[ID]);
+        GPIO_setPinValue(ENPortID, ENPinNum, GPIO_PINSTATE_RESET);
+        DWT_delayCycles(DWT_NS_TO_CYCLES(LCD_TIMENS_ENABLE_LOW));
 
-	GPIO_Port_t		ENPortID  = (GPIO_Port_t)CurrentLCD->EnablePin.PortID;
-	GPIO_Pin_t		ENPinNum  = (GPIO_Pin_t)CurrentLCD->EnablePin.PinNum;
-    switch(CurrentWriteCommandState[LCD_ID])
-    {        
-        case LCD_WRITELCD_READY:
+        if(CurrentLCD->DataLength == LCD_DL_4BIT)
         {
-            /* RS is low for command, high for data*/
-            GPIO_setPinValue(RSPortID, RSPinNum, RSPinState);
-            
-            if(CurrentLCD->DataLength == LCD_DL_8BIT)
-            {
-                WritePins(LCD_ID, Command);
+            /* The low nibble of the address counter is not used */
+            PulseEnable(ID);
+        }
+    }
 
-            }
-            else
+    GPIO_setPinValue((GPIO_Port_t)CurrentLCD->RWPin.PortID, (GPIO_Pin_t)CurrentLCD->RWPin.PinNum, GPIO_PINSTATE_RESET);
+    GPIO_setPinGroupMode(&DataPins[ID], GPIO_MODE_OUTPUT_PUSHPULL_NOPULL);
+
+    return !(Status & BusyFlag);
+}
+
+/**
+ * @brief Builds the data bus of an LCD, returns 0 if its data pins span more than LCD_BUS_MAX_PORTS ports
+ * or LCD_BUS_TABLE_WORDS can not hold its BSRR words.
+ */
+static uint32_t PinsInit(LCD_ID ID)
+{
+    LCD_Config_t const *CurrentLCD = &(LCD_Config[ID]);
+
+    /* The pins' direction is set by Board_init(), only the data bus group is built here */
+    uint8_t LCDPinCounter = 0;
+    uint8_t NumOfPins = (CurrentLCD->DataLength == LCD_DL_8BIT) ? 8 : 4;
+    GPIO_PinID_t GroupPins[8];
+    for(LCDPinCounter = 0; LCDPinCounter < NumOfPins; LCDPinCounter++)
+    {
+        GroupPins[LCDPinCounter].Port      = (GPIO_Port_t)CurrentLCD->Pins[LCDPinCounter].PortID;
+        GroupPins[LCDPinCounter].PinNumber = (GPIO_Pin_t)CurrentLCD->Pins[LCDPinCounter].PinNum;
+    }
+    GPIO_initPinGroup(&DataPins[ID], GroupPins, NumOfPins);
+    return BusInit(ID);
+}
+
+/**
+ * @brief Builds the BSRR words of every value of the data bus, 256 in 8-bit mode and 16 in 4-bit mode,
+ * for each port the data pins span.
+ * 
+ * The words are taken from BusTables once, a rebuild of the same bus reuses them.
+ */
+static uint32_t BusInit(LCD_ID ID)
+{
+    LCD_Config_t const *CurrentLCD = &(LCD_Config[ID]);
+    Bus_t *Bus = &Buses[ID];
+    uint32_t NumOfPins = (CurrentLCD->DataLength == LCD_DL_8BIT) ? 8 : 4;
+    uint32_t RSMask = 1UL << CurrentLCD->RSPin.PinNum;
+    uint8_t PortOfPin[8];
+    uint32_t PinCounter;
+    uint32_t PortCounter;
+    uint32_t Value;
+
+    Bus->NumOfPorts = 0;
+    for(PinCounter = 0; PinCounter < NumOfPins; PinCounter++)
+    {
+        uint8_t PortID = CurrentLCD->Pins[PinCounter].PortID;
+
+        for(PortCounter = 0; (PortCounter < Bus->NumOfPorts) && (Bus->Ports[PortCounter].Port != PortID); PortCounter++)
+        {
+        }
+        if(PortCounter == Bus->NumOfPorts)
+        {
+            assert_param(Bus->NumOfPorts < LCD_BUS_MAX_PORTS);
+            if(Bus->NumOfPorts >= LCD_BUS_MAX_PORTS)
             {
-                WritePins(LCD_ID, Command >> 4);
-                
+                return 0;
             }
+            Bus->Ports[PortCounter].Port = PortID;
+            Bus->Ports[PortCounter].BSRR = (uint32_t volatile *)(uintptr_t)GPIO_getSetResetRegAddress((GPIO_Port_t)PortID);
+            Bus->Ports[PortCounter].RSWords[LCD_SEND_CMD] = 0;
+            Bus->Ports[PortCounter].RSWords[LCD_SEND_DATA] = 0;
+            Bus->NumOfPorts++;
+        }
+        PortOfPin[PinCounter] = (uint8_t)PortCounter;
+    }
 
-            /* Start Send */
-            GPIO_setPinValue(ENPortID, ENPinNum, GPIO_PINSTATE_SET);
-            
-            CurrentWriteCommandState[LCD_ID] = LCD_WRITELCD_TRIGGER;      
-            break;
+    if(Bus->Ports[0].Words == NULL)
+    {
+        uint32_t TableWords = Bus->NumOfPorts << NumOfPins;
+
+        assert_param((BusTablesUsed + TableWords) <= LCD_BUS_TABLE_WORDS);
+        if((BusTablesUsed + TableWords) > LCD_BUS_TABLE_WORDS)
+        {
+            return 0;
         }
-        case LCD_WRITELCD_TRIGGER:
+        for(PortCounter = 0; PortCounter < Bus->NumOfPorts; PortCounter++)
         {
-            /* Send is done*/
-            GPIO_setPinValue(ENPortID, ENPinNum, GPIO_PINSTATE_RESET);
+            Bus->Ports[PortCounter].Words = &BusTables[BusTablesUsed];
+            BusTablesUsed += 1UL << NumOfPins;
+        }
+    }
 
-            if(CurrentLCD->DataLength == LCD_DL_4BIT)
-            {
-                CurrentWriteCommandState[LCD_ID] = LCD_WRITELCD_WRITEPINS_4BIT;
-            }
-            else
-            {
-                CurrentWriteCommandState[LCD_ID] = LCD_WRITELCD_READY;
-            }
-            break;
-        }        
-        case LCD_WRITELCD_WRITEPINS_4BIT:
+    for(Value = 0; Value < (1UL << NumOfPins); Value++)
+    {
+        for(PortCounter = 0; PortCounter < Bus->NumOfPorts; PortCounter++)
         {
-            WritePins(LCD_ID, Command);
-            GPIO_setPinValue(ENPortID, ENPinNum, GPIO_PINSTATE_SET);
-            CurrentWriteCommandState[LCD_ID] = LCD_WRITELCD_TRIGGER_4BIT;
+            Bus->Ports[PortCounter].Words[Value] = 0;
+        }
+        for(PinCounter = 0; PinCounter < NumOfPins; PinCounter++)
+        {
+            uint32_t PinMask = 1UL << CurrentLCD->Pins[PinCounter].PinNum;
+            Bus->Ports[PortOfPin[PinCounter]].Words[Value] |= (Value & (1UL << PinCounter)) ? PinMask : (PinMask << 16);
+        }
+    }
 
-            break;
+    /* RS is low for command, high for data */
+    Bus->RSWords[LCD_SEND_CMD] = RSMask << 16;
+    Bus->RSWords[LCD_SEND_DATA] = RSMask;
+    Bus->RSBSRR = (uint32_t volatile *)(uintptr_t)GPIO_getSetResetRegAddress((GPIO_Port_t)CurrentLCD->RSPin.PortID);
+    for(PortCounter = 0; PortCounter < Bus->NumOfPorts; PortCounter++)
+    {
+        if(Bus->Ports[PortCounter].Port == CurrentLCD->RSPin.PortID)
+        {
+            Bus->Ports[PortCounter].RSWords[LCD_SEND_CMD] = Bus->RSWords[LCD_SEND_CMD];
+            Bus->Ports[PortCounter].RSWords[LCD_SEND_DATA] = Bus->RSWords[LCD_SEND_DATA];
+            Bus->RSBSRR = NULL;
         }
+    }
+
+    Bus->ENBSRR = (uint32_t volatile *)(uintptr_t)GPIO_getSetResetRegAddress((GPIO_Port_t)CurrentLCD->EnablePin.PortID);
+    Bus->ENMask = 1UL << CurrentLCD->EnablePin.PinNum;
+
+    return 1;
+}
+
+static uint32_t IsIdle(LCD_ID ID)
+{
+    return (CurrentPhase[ID] == LCD_PHS_OFF) ||
+           ((CurrentPhase[ID] == LCD_PHS_OPERATION) &&
+            (CurrentOperation[ID] == LCD_OPERATION_NONE) &&
+            (CurrentWriteCommandState[ID] == LCD_WRITELCD_READY) &&
+            (QueueCount[ID] == 0) &&
+            !FrameBufferDirty[ID]);
+}
 
-        case LCD_WRITELCD_TRIGGER_4BIT:
+static uint8_t DDRAMAddress(uint8_t row, uint8_t col)
+{
+    return RowAddress[row] + col;
+}
+
+static void TrackDataWrite(LCD_ID ID, uint8_t Data)
+{
+    uint8_t row;
+
+    if(AddressCounter[ID] & LCD_ADDRESS_CGRAM)
+    {
+        AddressCounter[ID] = LCD_ADDRESS_CGRAM | ((AddressCounter[ID] + 1) & 0x3F);
+        return;
+    }
+
+    for(row = 0; row < LCD_NUM_OF_ROWS; row++)
+    {
+        if((AddressCounter[ID] >= RowAddress[row]) && (AddressCounter[ID] < (RowAddress[row] + LCD_NUM_OF_COLS)))
         {
-            /* Send is done*/
-            GPIO_setPinValue(ENPortID, ENPinNum, GPIO_PINSTATE_RESET);            
-            CurrentWriteCommandState[LCD_ID] = LCD_WRITELCD_READY;
+            DisplayedCells[ID][row][AddressCounter[ID] - RowAddress[row]] = Data;
             break;
         }
-
     }
 
+    /* The entry mode set by Init() increments the address after each data write, the end of a line
+       wraps to the start of the other one */
+    AddressCounter[ID]++;
+    if(AddressCounter[ID] == 0x28)
+    {
+        AddressCounter[ID] = 0x40;
+    }
+    else if(AddressCounter[ID] == 0x68)
+    {
+        AddressCounter[ID] = 0x00;
+    }
 }
 
+static void TrackCommand(LCD_ID ID, uint8_t Command)
+{
+    if(Command & (1 << 7))
+    {
+        /* Set DDRAM address */
+        AddressCounter[ID] = Command & 0x7F;
+    }
+    else if(Command & (1 << 6))
+    {
+        /* Set CGRAM address, the next data writes do not reach the display */
+        AddressCounter[ID] = LCD_ADDRESS_CGRAM | (Command & 0x3F);
+    }
+    else if(Command == 0x01)
+    {
+        /* Clear display */
+        BlankCells(DisplayedCells[ID]);
+        AddressCounter[ID] = 0;
+    }
+    else if((Command & 0xFE) == 0x02)
+    {
+        /* Return home */
+        AddressCounter[ID] = 0;
+    }
+}
 
-static void PinsInit(LCD_ID ID)
+static void BlankCells(uint8_t Cells[LCD_NUM_OF_ROWS][LCD_NUM_OF_COLS])
 {
-    LCD_Config_t const *CurrentLCD = &(LCD_Config[ID]);
+    uint8_t row;
+    uint8_t col;
 
-    /* Initializing current LCD pins' direction */
-    uint8_t LCDPinCounter = 0;
-    uint8_t NumOfPins = (CurrentLCD->DataLength == LCD_DL_8BIT) ? 8 : 4;
-    GPIO_PinConfig_t PinConfig;
-    for(LCDPinCounter = 0; LCDPinCounter < NumOfPins; LCDPinCounter++)
+    for(row = 0; row < LCD_NUM_OF_ROWS; row++)
     {
-        PinConfig.Port	        = (GPIO_Port_t)CurrentLCD->Pins[LCDPinCounter].PortID;
-        PinConfig.PinNumber		= (GPIO_Pin_t)CurrentLCD->Pins[LCDPinCounter].PinNum;
-        PinConfig.PinSpeed      = GPIO_SPEED_MEDIUM;
-        PinConfig.PinMode       = GPIO_MODE_OUTPUT_PUSHPULL_NOPULL;
-        GPIO_initPin(&PinConfig);
+        for(col = 0; col < LCD_NUM_OF_COLS; col++)
+        {
+            Cells[row][col] = ' ';
+        }
     }
+}
 
-    /* Initializing current RS pin direction */
-    PinConfig.Port		    = (GPIO_Port_t)CurrentLCD->RSPin.PortID;
-    PinConfig.PinNumber		= (GPIO_Pin_t)CurrentLCD->RSPin.PinNum;
-    GPIO_initPin(&PinConfig);
+/**
+ * @brief Selects the first cell of the frame buffer that differs from the display.
+ * 
+ * The set DDRAM address command is skipped when the address counter already points to the cell,
+ * so adjacent changed cells are sent as one run.
+ * 
+ * @return 1 if a cell is selected, 0 if the display matches the frame buffer.
+ */
+static uint32_t FlushNextCell(LCD_ID ID)
+{
+    FlushRequest_t *Flush = &UserRequest[ID].Flush;
+    uint8_t row;
+    uint8_t col;
 
+    for(row = 0; row < LCD_NUM_OF_ROWS; row++)
+    {
+        for(col = 0; col < LCD_NUM_OF_COLS; col++)
+        {
+            if(FrameBuffer[ID][row][col] != DisplayedCells[ID][row][col])
+            {
+                Flush->row  = row;
+                Flush->col  = col;
+                /* Latched, the frame buffer may change while the cell is being sent */
+                Flush->Data = FrameBuffer[ID][row][col];
+                Flush->Step = (AddressCounter[ID] == DDRAMAddress(row, col)) ? LCD_FLUSH_WRITE_CELL : LCD_FLUSH_SET_ADDRESS;
+                return 1;
+            }
+        }
+    }
 
-    /* Initializing current Enable pin direction */
-    PinConfig.Port		    = (GPIO_Port_t)CurrentLCD->EnablePin.PortID;
-    PinConfig.PinNumber		= (GPIO_Pin_t)CurrentLCD->EnablePin.PinNum;
-    GPIO_initPin(&PinConfig);
+    return 0;
+}
 
+static void NotifyReady(LCD_ID ID)
+{
+    if(ReadyCallBack[ID])
+    {
+        ReadyCallBack[ID](ID);
+    }
 }
 
 void LCD_task(void)
 {
     LCD_ID LCD_ID = 0;
+    uint32_t AllIdle = 1;
     for(LCD_ID = 0; LCD_ID < _NUM_OF_LCDS; LCD_ID++)  
     {
+        TaskStartCycles[LCD_ID] = DWT_getCycleCount();
+
         switch(CurrentPhase[LCD_ID])
         {
             case LCD_PHS_OFF:
@@ -256,13 +625,24 @@ void LCD_task(void)
                 break;
             
             case LCD_PHS_OPERATION:
-                Operate(LCD_ID);
+                /* The bytes are sent back-to-back until the wait budget runs out */
+                do
+                {
+                    Operate(LCD_ID);
+                } while((CurrentOperation[LCD_ID] != LCD_OPERATION_NONE) &&
+                        (CurrentWriteCommandState[LCD_ID] == LCD_WRITELCD_READY));
                 break;
         }
         elapsedTimeMS[LCD_ID]++;
 
+        AllIdle &= IsIdle(LCD_ID);
     }   
 
+    /* Nothing left to do, the task is signaled again by the next request */
+    if(AllIdle)
+    {
+        Sched_suspend(LCD_TASK_RUNNABLE_ID);
+    }
 }
 
 void Init(LCD_ID ID)
@@ -272,8 +652,12 @@ void Init(LCD_ID ID)
     {
         case LCD_INIT_PINS:
         {
-
-            PinsInit(ID);
+            /* Without its data bus the LCD is left off */
+            if(!PinsInit(ID))
+            {
+                CurrentPhase[ID] = LCD_PHS_OFF;
+                break;
+            }
             elapsedTimeMS[ID] = 0;
             CurrentInitStep[ID]++;
 
@@ -292,9 +676,12 @@ void Init(LCD_ID ID)
 
                     FunctionSetCommand = (1 << 5) | (CurrentLCD->DataLength << 4) | (1 << 3) | (CurrentLCD->Font << 2);
                     //FunctionSetCommand = 0x30;
-                    if(CurrentLCD->DataLength == LCD_DL_4BIT)
+                    if((CurrentLCD->DataLength == LCD_DL_4BIT) && (elapsedTimeMS[ID] == LCD_TIMEMS_WAKEUP))
                     {
-                        WriteLCD(LCD_ID, 0b0010, LCD_SEND_CMD);
+                        /* The controller wakes up with an 8-bit interface, a single transfer switches it to 4 bits */
+                        WriteBus(LCD_ID, 0b0010, LCD_SEND_CMD);
+                        PulseEnable(LCD_ID);
+                        ReadyCycles[LCD_ID] = DWT_getCycleCount() + DWT_NS_TO_CYCLES(LCD_TIMENS_EXECUTE);
                     }
                     WriteLCD(LCD_ID, FunctionSetCommand, LCD_SEND_CMD);
                     
@@ -303,6 +690,8 @@ void Init(LCD_ID ID)
                 {
                     CurrentInitStep[ID]++;
                     elapsedTimeMS[ID] = 0;
+                    /* The busy flag can not be read before the function set */
+                    UseBusyFlag[ID] = (LCD_Config[ID].RWPin.PortID != LCD_PORT_NONE);
 
                 }                        
 
@@ -323,7 +712,7 @@ void Init(LCD_ID ID)
                 cmd = (1 << 3) | (1 << 2) | (CurrentLCD->CursorState << 1) | (CurrentLCD->CursorBlinkingState >> 0);
                 WriteLCD(LCD_ID, cmd, LCD_SEND_CMD);                
             }        
-            if(CurrentWriteCommandState[0] == LCD_WRITELCD_READY && elapsedTimeMS[ID] > 8)
+            if(CurrentWriteCommandState[0] == LCD_WRITELCD_READY)
             {
                 CurrentInitStep[ID]++;
                 elapsedTimeMS[ID] = 0;
@@ -343,7 +732,7 @@ void Init(LCD_ID ID)
                 WriteLCD(LCD_ID, cmd, LCD_SEND_CMD);                
             }        
             
-            if(CurrentWriteCommandState[0] == LCD_WRITELCD_READY && elapsedTimeMS[ID] > 8)
+            if(CurrentWriteCommandState[0] == LCD_WRITELCD_READY)
             {
                 CurrentInitStep[ID]++;
                 elapsedTimeMS[ID] = 0;
@@ -362,10 +751,11 @@ void Init(LCD_ID ID)
                 WriteLCD(LCD_ID, cmd, LCD_SEND_CMD);                
             }        
             
-            if(CurrentWriteCommandState[0] == LCD_WRITELCD_READY && elapsedTimeMS[ID] > 5)
+            if(CurrentWriteCommandState[0] == LCD_WRITELCD_READY)
             {
                 CurrentPhase[ID] = LCD_PHS_OPERATION;
                 elapsedTimeMS[ID] = 0;
+                NotifyReady(ID);
 
             }           
             break;
@@ -375,26 +765,66 @@ void Init(LCD_ID ID)
  
 }
 
+static void StartNextOperation(LCD_ID ID)
+{
+    if(QueueCount[ID] > 0)
+    {
+        UserRequest[ID].StringIndex = 0;
+        CurrentOperation[ID] = RequestOperation[RequestQueue[ID][QueueHead[ID]].Type];
+    }
+    /* The frame buffer is flushed when no request is queued */
+    else if(FrameBufferDirty[ID])
+    {
+        FrameBufferDirty[ID] = 0;
+        if(FlushNextCell(ID))
+        {
+            CurrentOperation[ID] = LCD_OPERATION_FLUSH;
+        }
+    }
+}
+
+static void CompleteRequest(LCD_ID ID)
+{
+    LCD_DoneCallBack_t CallBack = RequestQueue[ID][QueueHead[ID]].CallBack;
+
+    QueueHead[ID] = (QueueHead[ID] + 1) % LCD_QUEUE_LENGTH;
+    QueueCount[ID]--;
+    CurrentOperation[ID] = LCD_OPERATION_NONE;
+
+    if(CallBack)
+    {
+        CallBack(ID);
+    }
+    NotifyReady(ID);
+
+    /* The next request is picked up right away, LCD_task() keeps sending it in the same call while the wait budget lasts */
+    StartNextOperation(ID);
+}
+
 static void Operate(LCD_ID ID)
 {
+    LCD_Request_t const *Request = &RequestQueue[ID][QueueHead[ID]];
 
     switch(CurrentOperation[ID])
     {
         case LCD_OPERATION_WRITE_STRING:
         {
-            uint32_t index = UserRequest[ID].StringRequest.index;
-            uint8_t *buffer = UserRequest[ID].StringRequest.Buffer;
-
-            WriteLCD(ID, buffer[index], LCD_SEND_DATA);
+            uint32_t index = UserRequest[ID].StringIndex;
 
-            if(CurrentWriteCommandState[ID] == LCD_WRITELCD_READY)
+            if(index < Request->Len)
             {
-                UserRequest[ID].StringRequest.index++;
+                WriteLCD(ID, (uint8_t)Request->Str[index], LCD_SEND_DATA);
+
+                if(CurrentWriteCommandState[ID] == LCD_WRITELCD_READY)
+                {
+                    TrackDataWrite(ID, (uint8_t)Request->Str[index]);
+                    UserRequest[ID].StringIndex++;
+                }
             }
 
-            if((CurrentWriteCommandState[ID] == LCD_WRITELCD_READY) && UserRequest[ID].StringRequest.index == UserRequest[ID].StringRequest.len)
+            if((CurrentWriteCommandState[ID] == LCD_WRITELCD_READY) && (UserRequest[ID].StringIndex == Request->Len))
             {
-                CurrentOperation[ID] = LCD_OPERATION_NONE;
+                CompleteRequest(ID);
             }
             break;
         }
@@ -403,12 +833,13 @@ static void Operate(LCD_ID ID)
             uint8_t cmd = 0;
             cmd |= (1 << 7);
 
-            cmd |= (UserRequest[ID].CursorPos.row * 0x40) + UserRequest[ID].CursorPos.col;
+            cmd |= DDRAMAddress(Request->Row, Request->Col);
             WriteLCD(ID, cmd, LCD_SEND_CMD);
 
             if(CurrentWriteCommandState[ID] == LCD_WRITELCD_READY)
             {
-                CurrentOperation[ID] = LCD_OPERATION_NONE;
+                TrackCommand(ID, cmd);
+                CompleteRequest(ID);
             }
             break;
         }
@@ -421,54 +852,229 @@ static void Operate(LCD_ID ID)
 
             if(CurrentWriteCommandState[ID] == LCD_WRITELCD_READY)
             {
-                CurrentOperation[ID] = LCD_OPERATION_NONE;
+                TrackCommand(ID, cmd);
+                CompleteRequest(ID);
+            }
+            break;
+        }
+        case LCD_OPERATION_COMMAND:
+        {
+            WriteLCD(ID, Request->Command, LCD_SEND_CMD);
+
+            if(CurrentWriteCommandState[ID] == LCD_WRITELCD_READY)
+            {
+                TrackCommand(ID, Request->Command);
+                CompleteRequest(ID);
+            }
+            break;
+        }
+        case LCD_OPERATION_FLUSH:
+        {
+            FlushRequest_t *Flush = &UserRequest[ID].Flush;
+
+            if(Flush->Step == LCD_FLUSH_SET_ADDRESS)
+            {
+                uint8_t cmd = (1 << 7) | DDRAMAddress(Flush->row, Flush->col);
+
+                WriteLCD(ID, cmd, LCD_SEND_CMD);
+
+                if(CurrentWriteCommandState[ID] == LCD_WRITELCD_READY)
+                {
+                    TrackCommand(ID, cmd);
+                    Flush->Step = LCD_FLUSH_WRITE_CELL;
+                }
+            }
+            else
+            {
+                WriteLCD(ID, Flush->Data, LCD_SEND_DATA);
+
+                if(CurrentWriteCommandState[ID] == LCD_WRITELCD_READY)
+                {
+                    TrackDataWrite(ID, Flush->Data);
+                    if(!FlushNextCell(ID))
+                    {
+                        CurrentOperation[ID] = LCD_OPERATION_NONE;
+                        NotifyReady(ID);
+                        StartNextOperation(ID);
+                    }
+                }
+            }
+            break;
+        }
+        case LCD_OPERATION_NONE:
+        {
+            StartNextOperation(ID);
+
+            /* A request queued while idle starts sending right away */
+            if(CurrentOperation[ID] != LCD_OPERATION_NONE)
+            {
+                Operate(ID);
             }
             break;
         }
-        case LCD_OPERATION_NONE:break;
     }        
 
 }
 
 void LCD_init(LCD_ID ID)
 {
+    /* The initialization clears the display */
+    BlankCells(FrameBuffer[ID]);
+    BlankCells(DisplayedCells[ID]);
+    AddressCounter[ID] = 0;
+    UseBusyFlag[ID] = 0;
+
+    DWT_init();
+    ReadyCycles[ID] = DWT_getCycleCount();
+
     CurrentPhase[ID] = LCD_PHS_INIT;
+    Sched_signal(LCD_TASK_RUNNABLE_ID);
 }
 LCD_State_t LCD_getState(LCD_ID ID)
 {
-    return ((CurrentPhase[ID] == LCD_PHS_OPERATION) && (CurrentOperation[ID] == LCD_OPERATION_NONE)) ? LCD_STATE_READY : LCD_STATE_BUSY;
+    return ((CurrentPhase[ID] == LCD_PHS_OPERATION) && (CurrentOperation[ID] == LCD_OPERATION_NONE) &&
+            (QueueCount[ID] == 0) && !FrameBufferDirty[ID]) ? LCD_STATE_READY : LCD_STATE_BUSY;
 }
 
-void LCD_clearScreenAsync(LCD_ID ID)
+LCD_Error_t LCD_clearScreenAsync(LCD_ID ID)
 {
+    LCD_Request_t Request = {.Type = LCD_REQUEST_CLEAR_SCREEN};
+
+    return LCD_enqueueRequests(ID, &Request, 1);
+}
+LCD_Error_t LCD_setCursorPositionAsync(LCD_ID ID, uint8_t row, uint8_t col)
+{
+    LCD_Request_t Request = {.Type = LCD_REQUEST_SET_CURSOR, .Row = row, .Col = col};
+
+    return LCD_enqueueRequests(ID, &Request, 1);
+}
+LCD_Error_t LCD_writeStringAsync(LCD_ID ID, char* str, uint32_t len)
+{
+    LCD_Request_t Request = {.Type = LCD_REQUEST_WRITE_STRING, .Str = str, .Len = len};
+
+    return LCD_enqueueRequests(ID, &Request, 1);
+}
+
+LCD_Error_t LCD_sendCommandAsync(LCD_ID ID, uint8_t Command, LCD_DoneCallBack_t CallBack)
+{
+    LCD_Request_t Request = {.Type = LCD_REQUEST_COMMAND, .Command = Command, .CallBack = CallBack};
+
+    return LCD_enqueueRequests(ID, &Request, 1);
+}
+
+LCD_Error_t LCD_enqueueRequests(LCD_ID ID, LCD_Request_t const *Requests, uint32_t NumOfRequests)
+{
+    uint32_t idx;
+
     assert_param(ID < _NUM_OF_LCDS);
-    if(CurrentOperation[ID] == LCD_OPERATION_NONE)
+    assert_param(Requests || (NumOfRequests == 0));
+
+    if(NumOfRequests > (LCD_QUEUE_LENGTH - QueueCount[ID]))
     {
-        CurrentOperation[ID] = LCD_OPERATION_SETCURSOR_POS;
-    }  
+        return LCD_NOK;
+    }
+
+    for(idx = 0; idx < NumOfRequests; idx++)
+    {
+        assert_param(Requests[idx].Type <= LCD_REQUEST_COMMAND);
+        assert_param((Requests[idx].Type != LCD_REQUEST_SET_CURSOR) || (Requests[idx].Row < LCD_NUM_OF_ROWS));
+        assert_param((Requests[idx].Type != LCD_REQUEST_WRITE_STRING) || Requests[idx].Str || (Requests[idx].Len == 0));
+
+        RequestQueue[ID][(QueueHead[ID] + QueueCount[ID]) % LCD_QUEUE_LENGTH] = Requests[idx];
+        QueueCount[ID]++;
+    }
+
+    if(NumOfRequests > 0)
+    {
+        Sched_signal(LCD_TASK_RUNNABLE_ID);
+    }
+
+    return LCD_OK;
 }
-void LCD_setCursorPositionAsync(LCD_ID ID, uint8_t row, uint8_t col)
+
+void LCD_writeFrameBuffer(LCD_ID ID, uint8_t row, uint8_t col, char const *str, uint32_t len)
 {
+    uint32_t Changed = 0;
+
     assert_param(ID < _NUM_OF_LCDS);
-     if(CurrentOperation[ID] == LCD_OPERATION_NONE)
-    {
-        UserRequest[ID].CursorPos.row = row;
-        UserRequest[ID].CursorPos.col = col;
+    assert_param((row < LCD_NUM_OF_ROWS) && (col < LCD_NUM_OF_COLS));
+    assert_param(str || (len == 0));
 
-        CurrentOperation[ID] = LCD_OPERATION_SETCURSOR_POS;
-    }   
+    for(; (len > 0) && (col < LCD_NUM_OF_COLS); len--, col++, str++)
+    {
+        FrameBuffer[ID][row][col] = (uint8_t)*str;
+        Changed |= (FrameBuffer[ID][row][col] != DisplayedCells[ID][row][col]);
+    }
 
+    /* Text already on the display does not wake the LCD task up */
+    if(Changed)
+    {
+        FrameBufferDirty[ID] = 1;
+        Sched_signal(LCD_TASK_RUNNABLE_ID);
+    }
 }
-void LCD_writeStringAsync(LCD_ID ID, char* str, uint32_t len)
+
+void LCD_clearFrameBuffer(LCD_ID ID)
 {
+    uint32_t Changed = 0;
+    uint8_t row;
+    uint8_t col;
+
     assert_param(ID < _NUM_OF_LCDS);
 
-    if(CurrentOperation[ID] == LCD_OPERATION_NONE)
+    for(row = 0; row < LCD_NUM_OF_ROWS; row++)
+    {
+        for(col = 0; col < LCD_NUM_OF_COLS; col++)
+        {
+            FrameBuffer[ID][row][col] = ' ';
+            Changed |= (DisplayedCells[ID][row][col] != ' ');
+        }
+    }
+
+    if(Changed)
+    {
+        FrameBufferDirty[ID] = 1;
+        Sched_signal(LCD_TASK_RUNNABLE_ID);
+    }
+}
+
+uint32_t LCD_getPinConfigs(GPIO_PinConfig_t *PinConfigs, uint32_t MaxPins)
+{
+    uint32_t NumOfConfigs = 0;
+    uint32_t ID;
+
+    assert_param(PinConfigs || (MaxPins == 0));
+
+    for(ID = 0; ID < _NUM_OF_LCDS; ID++)
     {
-        UserRequest[ID].StringRequest.Buffer = (uint8_t*)str;
-        UserRequest[ID].StringRequest.len = len;
-        UserRequest[ID].StringRequest.index = 0;
+        LCD_Config_t const *CurrentLCD = &(LCD_Config[ID]);
+        uint32_t NumOfDataPins = (CurrentLCD->DataLength == LCD_DL_8BIT) ? 8 : 4;
+        uint32_t NumOfPins = NumOfDataPins + ((CurrentLCD->RWPin.PortID != LCD_PORT_NONE) ? 3 : 2);
+        uint32_t PinCounter;
 
-        CurrentOperation[ID] = LCD_OPERATION_WRITE_STRING;
+        /* Data pins, then RS, Enable and RW if connected */
+        for(PinCounter = 0; PinCounter < NumOfPins; PinCounter++)
+        {
+            LCD_Pin_t const *Pin = (PinCounter < NumOfDataPins) ? &CurrentLCD->Pins[PinCounter] :
+                                   (PinCounter == NumOfDataPins) ? &CurrentLCD->RSPin :
+                                   (PinCounter == (NumOfDataPins + 1)) ? &CurrentLCD->EnablePin : &CurrentLCD->RWPin;
+            if(NumOfConfigs < MaxPins)
+            {
+                PinConfigs[NumOfConfigs].Port      = (GPIO_Port_t)Pin->PortID;
+                PinConfigs[NumOfConfigs].PinNumber = (GPIO_Pin_t)Pin->PinNum;
+                PinConfigs[NumOfConfigs].PinSpeed  = GPIO_SPEED_MEDIUM;
+                PinConfigs[NumOfConfigs].PinMode   = GPIO_MODE_OUTPUT_PUSHPULL_NOPULL;
+            }
+            NumOfConfigs++;
+        }
     }
+
+    return NumOfConfigs;
+}
+
+void LCD_setReadyCallBack(LCD_ID ID, LCD_ReadyCallBack_t CallBack)
+{
+    assert_param(ID < _NUM_OF_LCDS);
+
+    ReadyCallBack[ID] = CallBack;
 }
\ No newline at end of file
@@ -6,16 +6,35 @@
 /********************************************************************************************************/
 #include <stdint.h>
 #include "LCD_Cfg.h"
+#include "MCAL/GPIO/GPIO.h"
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief Port ID of an unconnected pin.
+ */
+#define LCD_PORT_NONE 0xFFU
+
+/**
+ * @brief Initializer of an unconnected pin, e.g. LCD_Config_t.RWPin when RW is tied low.
+ */
+#define LCD_PIN_NONE {LCD_PORT_NONE, 0xFFU}
 
 
 /********************************************************************************************************/
 /************************************************Types***************************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief Enumeration for LCD-related errors.
+ */
+typedef enum
+{
+    LCD_OK,     /**< Operation successful */
+    LCD_NOK     /**< Operation not successful */
+} LCD_Error_t;
+
 /**
  * @brief Enumeration for the data length (4-bit or 8-bit)
  */
@@ -73,6 +92,11 @@ typedef struct
 
 /**
  * @brief Structure defining LCD configuration
+ * 
+ * The bus timings are waited on the DWT cycle counter and the bytes are sent back-to-back, several
+ * per LCD_task() call (see LCD_WAIT_BUDGET_US). With an RW pin, the driver reads the busy flag of the
+ * controller after the function set and sends each byte as soon as the controller is ready. Without
+ * it, the driver waits the execution times of the datasheet.
  */
 typedef struct  
 {
@@ -83,12 +107,48 @@ typedef struct
 
     LCD_Pin_t EnablePin;					        /**< Pin configuration for Enable */
     LCD_Pin_t RSPin;						        /**< Pin configuration for RS (Register Select) */
+    LCD_Pin_t RWPin;                                /**< Pin configuration for RW (Read/Write), LCD_PIN_NONE if RW is tied low */
 
     LCD_Pin_t Pins[8];						        /**< Pins configuration */
 } LCD_Config_t;
 
 
 
+/**
+ * @brief Callback invoked when an LCD becomes ready for a new request.
+ */
+typedef void (*LCD_ReadyCallBack_t)(LCD_ID ID);
+
+/**
+ * @brief Callback invoked from LCD_task() when a queued request is done.
+ */
+typedef void (*LCD_DoneCallBack_t)(LCD_ID ID);
+
+/**
+ * @brief Enumeration for the types of queued requests.
+ */
+typedef enum
+{
+    LCD_REQUEST_SET_CURSOR,     /**< Moves the cursor to Row/Col */
+    LCD_REQUEST_WRITE_STRING,   /**< Writes Len characters of Str at the cursor */
+    LCD_REQUEST_CLEAR_SCREEN,   /**< Clears the screen and moves the cursor home */
+    LCD_REQUEST_COMMAND,        /**< Sends Command as is to the controller */
+} LCD_RequestType_t;
+
+/**
+ * @brief Structure describing a queued request, only the fields used by its type are read.
+ */
+typedef struct
+{
+    LCD_RequestType_t Type;         /**< Type of the request */
+    uint8_t Row;                    /**< Row of the cursor (LCD_REQUEST_SET_CURSOR) */
+    uint8_t Col;                    /**< Column of the cursor (LCD_REQUEST_SET_CURSOR) */
+    char const *Str;                /**< String, must stay valid until the request is done (LCD_REQUEST_WRITE_STRING) */
+    uint32_t Len;                   /**< Length of the string (LCD_REQUEST_WRITE_STRING) */
+    uint8_t Command;                /**< Instruction byte (LCD_REQUEST_COMMAND) */
+    LCD_DoneCallBack_t CallBack;    /**< Invoked when the request is done, NULL for none */
+} LCD_Request_t;
+
 extern LCD_Config_t LCD_Config[_NUM_OF_LCDS];
 /********************************************************************************************************/
 /************************************************APIs****************************************************/
@@ -105,34 +165,107 @@ void LCD_task(void);
  * @brief Initializes the LCD identified by the given ID.
  * 
  * @param ID The ID of the LCD to initialize.
+ * @note The pins must have been configured by Board_init() first.
  */
 void LCD_init(LCD_ID ID);
 
 /**
  * @brief Retrieves the current state of the LCD.
- * @return LCD_State_t Current state of the LCD.
+ * @return LCD_State_t Current state of the LCD, busy until the queue is empty and the frame buffer is flushed.
  */
 LCD_State_t LCD_getState(LCD_ID ID);
 
 /**
- * @brief Clears the screen of the specified LCD asynchronously.
+ * @brief Queues a clear screen request on the specified LCD.
  * @param ID The ID of the LCD to clear.
+ * @return LCD_OK on success, LCD_NOK if the queue is full.
  */
-void LCD_clearScreenAsync(LCD_ID ID);
+LCD_Error_t LCD_clearScreenAsync(LCD_ID ID);
 
 /**
- * @brief Sets the cursor position on the specified LCD asynchronously.
+ * @brief Queues a set cursor position request on the specified LCD.
  * @param ID The ID of the LCD to set the cursor position.
+ * @return LCD_OK on success, LCD_NOK if the queue is full.
  */
-void LCD_setCursorPositionAsync(LCD_ID ID, uint8_t row, uint8_t col);
+LCD_Error_t LCD_setCursorPositionAsync(LCD_ID ID, uint8_t row, uint8_t col);
 
 /**
- * @brief Writes a string to the specified LCD asynchronously.
+ * @brief Queues a write string request on the specified LCD.
  * @param ID The ID of the LCD to write the string.
- * @param str Pointer to the string to write.
+ * @param str Pointer to the string to write, must stay valid until the string is written.
  * @param len Length of the string.
+ * @return LCD_OK on success, LCD_NOK if the queue is full.
+ */
+LCD_Error_t LCD_writeStringAsync(LCD_ID ID, char* str, uint32_t len);
+
+/**
+ * @brief Queues an instruction byte to send as is to the controller of the specified LCD.
+ * 
+ * Clear display, return home and set DDRAM/CGRAM address instructions are tracked by the frame buffer,
+ * the others (e.g. display shift) are not.
+ * 
+ * @param ID The ID of the LCD.
+ * @param Command The instruction byte.
+ * @param CallBack Invoked when the command is sent, NULL for none.
+ * @return LCD_OK on success, LCD_NOK if the queue is full.
+ */
+LCD_Error_t LCD_sendCommandAsync(LCD_ID ID, uint8_t Command, LCD_DoneCallBack_t CallBack);
+
+/**
+ * @brief Queues several requests at once, e.g. a whole screen update.
+ * 
+ * LCD_task() executes the queued requests in order and back-to-back, starting the next request
+ * in the tick that completes the previous one.
+ * 
+ * @param ID The ID of the LCD.
+ * @param Requests Array of the requests, copied before returning.
+ * @param NumOfRequests Number of requests.
+ * @return LCD_OK on success, LCD_NOK if the queue can not take all the requests, none is queued then.
+ */
+LCD_Error_t LCD_enqueueRequests(LCD_ID ID, LCD_Request_t const *Requests, uint32_t NumOfRequests);
+
+/**
+ * @brief Writes a string to the frame buffer of the specified LCD, the string is clipped at the end of the row.
+ * 
+ * LCD_task() then sends only the cells that differ from what the display shows, adjacent changed
+ * cells being sent as one run after a single set DDRAM address command. Rewriting the same text at
+ * the same position costs no bus traffic.
+ * 
+ * @param ID The ID of the LCD.
+ * @param row Row of the first character, below LCD_NUM_OF_ROWS.
+ * @param col Column of the first character, below LCD_NUM_OF_COLS.
+ * @param str Pointer to the string to write, copied before returning.
+ * @param len Length of the string.
+ * @note The frame buffer is blanked by LCD_init(). The cells changed by LCD_writeStringAsync() or
+ *       LCD_clearScreenAsync() are tracked, the next flush writes the frame buffer back over them.
+ */
+void LCD_writeFrameBuffer(LCD_ID ID, uint8_t row, uint8_t col, char const *str, uint32_t len);
+
+/**
+ * @brief Fills the frame buffer of the specified LCD with spaces, see LCD_writeFrameBuffer().
+ * @param ID The ID of the LCD.
+ */
+void LCD_clearFrameBuffer(LCD_ID ID);
+
+/**
+ * @brief Sets the callback invoked from LCD_task() each time the LCD finishes its initialization
+ *        or an asynchronous request (after the request's own callback).
+ * 
+ * Typically used to Sched_signal() a runnable waiting for the LCD to be ready.
+ * 
+ * @param ID The ID of the LCD.
+ * @param CallBack Callback to invoke, NULL to disable it.
+ */
+void LCD_setReadyCallBack(LCD_ID ID, LCD_ReadyCallBack_t CallBack);
+
+/**
+ * @brief Lists the configuration of the pins of all the LCDs, used by Board_init().
+ * 
+ * @param PinConfigs Array receiving the configurations.
+ * @param MaxPins Size of PinConfigs, the configurations that do not fit are not written.
+ * @return The number of pin configurations of the LCDs.
  */
-void LCD_writeStringAsync(LCD_ID ID, char* str, uint32_t len);
+uint32_t LCD_getPinConfigs(GPIO_PinConfig_t *PinConfigs, uint32_t MaxPins);
 
 
 
@@ -59,6 +59,8 @@ LCD_Config_t LCD_Config[_NUM_OF_LCDS]=
 			.PortID= GPIO_GPIOA,
 			.PinNum= GPIO_PIN0,
 		},
+		/* RW is tied low on this board */
+		.RWPin = LCD_PIN_NONE,
 		.EnablePin = 
 		{
 			.PortID= GPIO_GPIOA,
@@ -14,6 +14,7 @@
 /********************************************************************************************************/
 /************************************************Includes************************************************/
 /********************************************************************************************************/
+#include "Services/Scheduler/Scheduler_cfg.h"
 
 
 /********************************************************************************************************/
@@ -25,6 +26,41 @@
  */
 #define LCD_TASK_PERIODICITYMS 1UL
 
+/**
+ * @brief Scheduler runnable executing LCD_task(), it is suspended while every LCD is idle
+ *        and signaled whenever a new request is made.
+ */
+#define LCD_TASK_RUNNABLE_ID SCHED_LCD
+
+/**
+ * @brief Size of the frame buffer of each LCD (see LCD_writeFrameBuffer()), the visible area of the display.
+ * @note At most 4 rows.
+ */
+#define LCD_NUM_OF_ROWS 2UL
+#define LCD_NUM_OF_COLS 16UL
+
+/**
+ * @brief Number of requests each LCD can queue, see LCD_enqueueRequests().
+ */
+#define LCD_QUEUE_LENGTH 8UL
+
+/**
+ * @brief Time in microseconds each LCD_task() call may busy-wait for the controller of each LCD,
+ *        the rest of the work is left to the next call.
+ * 
+ * The bytes are sent back-to-back within this budget, about 40 us each: 400 us moves around ten
+ * characters per call, 1600 us a whole 2x16 screen.
+ */
+#define LCD_WAIT_BUDGET_US 400UL
+
+/**
+ * @brief Words of the tables driving the data buses of all the LCDs, each value of a bus is sent with one store per port.
+ * 
+ * An LCD takes 256 words per port spanned by its data pins in 8-bit mode, 16 in 4-bit mode. An LCD
+ * that does not fit is left off by LCD_init().
+ */
+#define LCD_BUS_TABLE_WORDS 256UL
+
 
 
 /********************************************************************************************************/
@@ -10,7 +10,7 @@
 /********************************************************************************************************/
 /************************************************Includes************************************************/
 /********************************************************************************************************/
-#include "LED.h"
+#include "Led.h"
 #include "Led_cfg.h"
 #include "MCAL/GPIO/GPIO.h"
 #include "assertparam.h"
@@ -49,45 +49,79 @@
 /********************************************************************************************************/
 /*****************************************Static Functions Prototype*************************************/
 /********************************************************************************************************/
-
+static void WritePin(GPIO_Port_t Port, GPIO_Pin_t PinNum, GPIO_PinState_t PinState);
+static GPIO_PinMode_t GetPinMode(LED_Config_t const *LedConfig);
 
 
 /********************************************************************************************************/
 /*********************************************APIs Implementation****************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief Drives an LED pin, through the output shadow when it is enabled.
+ */
+static void WritePin(GPIO_Port_t Port, GPIO_Pin_t PinNum, GPIO_PinState_t PinState)
+{
+#if OUTPUTSHADOW_ENABLED
+    OutputShadow_writePins(Port, 1UL << PinNum, (uint32_t)PinState << PinNum);
+#else
+    GPIO_setPinValue(Port, PinNum, PinState);
+#endif
+}
+
+/**
+ * @brief Mode of the pin of an LED, set by Board_init() through LED_getPinConfigs().
+ */
+static GPIO_PinMode_t GetPinMode(LED_Config_t const *LedConfig)
+{
+    return (LedConfig->ActiveType == LED_ACTIVEHIGH) ? GPIO_MODE_OUTPUT_PUSHPULL_NOPULL : GPIO_MODE_OUTPUT_PUSHPULL_PULLUP;
+}
+
 LED_Error_t LED_Init(void)
 {
     LED_Error_t RetErrorStatus = LED_OK;
 
-    /* Initialize each LED based on the configuration */
-    GPIO_PinConfig_t CurrentPin;
+    /* Setting each LED to its initial state, the pins are configured by Board_init() */
     for (uint32_t LedCounter = 0; LedCounter < (uint32_t) _NUM_OF_LEDS; LedCounter++)
     {
         LED_Config_t *CurrentLedConfig = &LED_Configs[LedCounter];
-        
+
         /* Parameters validation */
         assert_param(IS_LED_ACTIVE_TYPE(CurrentLedConfig->ActiveType));
         assert_param(IS_LED_STATE(CurrentLedConfig->LedInitState));
 
-        /* Each pin initialization */
-        CurrentPin.Port = (GPIO_Port_t)CurrentLedConfig->PortID;
-        CurrentPin.PinNumber = (GPIO_Pin_t)CurrentLedConfig->PinNum;
-        CurrentPin.PinSpeed = GPIO_SPEED_MEDIUM;
-        CurrentPin.PinMode = (CurrentLedConfig->ActiveType == LED_ACTIVEHIGH ) ?
-                     GPIO_MODE_OUTPUT_PUSHPULL_NOPULL : GPIO_MODE_OUTPUT_PUSHPULL_PULLUP;
-
-        GPIO_initPin(&CurrentPin);
+        /* LED_getPinConfigs() missing from Board_PinSources, or another module took the pin */
+        if(GPIO_getPinMode((GPIO_Port_t)CurrentLedConfig->PortID, (GPIO_Pin_t)CurrentLedConfig->PinNum) != GetPinMode(CurrentLedConfig))
+        {
+            RetErrorStatus = LED_NOK;
+            continue;
+        }
 
         /* Determine Pin is high or low based on the active type of the LED*/
         GPIO_PinState_t PinState = (GPIO_PinState_t)(CurrentLedConfig->LedInitState ^ (LED_State_t)CurrentLedConfig->ActiveType);
-
-        GPIO_setPinValue(CurrentPin.Port, CurrentPin.PinNumber, PinState);
+        WritePin((GPIO_Port_t)CurrentLedConfig->PortID, (GPIO_Pin_t)CurrentLedConfig->PinNum, PinState);
     }
 
     return RetErrorStatus;
 }
 
+uint32_t LED_getPinConfigs(GPIO_PinConfig_t *PinConfigs, uint32_t MaxPins)
+{
+    assert_param(PinConfigs || (MaxPins == 0));
+
+    for (uint32_t LedCounter = 0; (LedCounter < (uint32_t) _NUM_OF_LEDS) && (LedCounter < MaxPins); LedCounter++)
+    {
+        LED_Config_t *CurrentLedConfig = &LED_Configs[LedCounter];
+
+        PinConfigs[LedCounter].Port = (GPIO_Port_t)CurrentLedConfig->PortID;
+        PinConfigs[LedCounter].PinNumber = (GPIO_Pin_t)CurrentLedConfig->PinNum;
+        PinConfigs[LedCounter].PinSpeed = GPIO_SPEED_MEDIUM;
+        PinConfigs[LedCounter].PinMode = GetPinMode(CurrentLedConfig);
+    }
+
+    return _NUM_OF_LEDS;
+}
+
 LED_Error_t LED_setLedState(uint8_t LedID, LED_State_t LedState)
 {
     /* Parameters validation */
@@ -101,7 +135,7 @@ LED_Error_t LED_setLedState(uint8_t LedID, LED_State_t LedState)
 
     GPIO_PinState_t PinState = (GPIO_PinState_t)(LedState ^ (LED_State_t)ActiveType);
 
-    GPIO_setPinValue((GPIO_Port_t)PortID, (GPIO_Pin_t)PinNum, PinState);
+    WritePin((GPIO_Port_t)PortID, (GPIO_Pin_t)PinNum, PinState);
 
     return LED_OK;
 }
@@ -115,7 +149,12 @@ LED_State_t LED_getLedState(uint8_t LedID)
     uint8_t PinNum = LED_Configs[LedID].PinNum;
     LED_ActiveType_t ActiveType = LED_Configs[LedID].ActiveType;
 
+#if OUTPUTSHADOW_ENABLED
+    /* The pending state, the pin may not have been committed yet */
+    LED_State_t LedState = (LED_State_t)(((OutputShadow_getPins((GPIO_Port_t)PortID) >> PinNum) & 1UL) ^ (uint32_t)ActiveType);
+#else
     LED_State_t LedState = GPIO_getPinValue((GPIO_Port_t)PortID, (GPIO_Pin_t)PinNum ^ ActiveType);
+#endif
 
 
     return LedState;
@@ -15,6 +15,8 @@
 /********************************************************************************************************/
 #include <stdint.h>
 #include "Led_cfg.h"
+#include "MCAL/GPIO/GPIO_Pin.h"
+#include "Services/OutputShadow/OutputShadow.h"
 
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
@@ -68,7 +70,9 @@ extern LED_Config_t LED_Configs[_NUM_OF_LEDS];
 
 /**
  * @brief Initialize LEDs using the configurations in LED_Configs.
- * @return LED_Error_t Error status after initializing the LEDs.
+ * @note The pins must have been configured by Board_init() first.
+ * @note With OUTPUTSHADOW_ENABLED, OutputShadow_init() must have been called first.
+ * @return LED_Error_t LED_NOK if a pin is not in the mode of its LED, that LED is then left untouched.
  */
 LED_Error_t LED_Init(void);
 
@@ -87,4 +91,45 @@ LED_Error_t LED_setLedState(uint8_t LedID, LED_State_t LedState);
  */
 LED_State_t LED_getLedState(uint8_t LedID);
 
+/**
+ * @brief List the configuration of the LEDs pins, used by Board_init().
+ * @param PinConfigs Array receiving the configurations.
+ * @param MaxPins Size of PinConfigs, the configurations that do not fit are not written.
+ * @return uint32_t Number of pin configurations of the LEDs.
+ */
+uint32_t LED_getPinConfigs(GPIO_PinConfig_t *PinConfigs, uint32_t MaxPins);
+
+#if OUTPUTSHADOW_ENABLED
+/**
+ * @brief Turn on/off an LED known at build time, updates the output shadow.
+ * @param LedID ID of the LED spelled as in LEDS (e.g. LED_RED), a variable is not accepted.
+ * @param LedState State to be applied (LED_ON or LED_OFF).
+ */
+#define LED_setLedStateFast(LedID, LedState) \
+    (GPIO_PIN_STATIC_CHECK(LedID##_PORT, LedID##_PIN), \
+     OutputShadow_writePins(LedID##_PORT, 1UL << LedID##_PIN, ((uint32_t)((LedState) ^ LedID##_ACTIVETYPE)) << LedID##_PIN))
+
+/**
+ * @brief Toggle an LED known at build time, updates the output shadow.
+ * @param LedID ID of the LED spelled as in LEDS (e.g. LED_RED), a variable is not accepted.
+ */
+#define LED_toggleLedFast(LedID) \
+    (GPIO_PIN_STATIC_CHECK(LedID##_PORT, LedID##_PIN), OutputShadow_togglePins(LedID##_PORT, 1UL << LedID##_PIN))
+#else
+/**
+ * @brief Turn on/off an LED known at build time, compiles to a single BSRR store.
+ * @param LedID ID of the LED spelled as in LEDS (e.g. LED_RED), a variable is not accepted.
+ * @param LedState State to be applied (LED_ON or LED_OFF).
+ */
+#define LED_setLedStateFast(LedID, LedState) \
+    GPIO_pinWrite(GPIO_PIN_HANDLE(LedID##_PORT, LedID##_PIN), (GPIO_PinState_t)((LedState) ^ LedID##_ACTIVETYPE))
+
+/**
+ * @brief Toggle an LED known at build time, an ODR load followed by a BSRR store.
+ * @param LedID ID of the LED spelled as in LEDS (e.g. LED_RED), a variable is not accepted.
+ */
+#define LED_toggleLedFast(LedID) \
+    GPIO_pinToggle(GPIO_PIN_HANDLE(LedID##_PORT, LedID##_PIN))
+#endif
+
 #endif // HAL_LED_LED_H_
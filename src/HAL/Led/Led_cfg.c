@@ -32,24 +32,24 @@
  {
 	[LED_RED]=
 	{
-        .PortID = 0,
-        .PinNum = 0,
-        .ActiveType = LED_ACTIVEHIGH,
+        .PortID = LED_RED_PORT,
+        .PinNum = LED_RED_PIN,
+        .ActiveType = LED_RED_ACTIVETYPE,
         .LedInitState = LED_OFF,
 	},
     
 	[LED_YELLOW]=
 	{
-        .PortID = 0,
-        .PinNum = 1,
-        .ActiveType = LED_ACTIVEHIGH,
+        .PortID = LED_YELLOW_PORT,
+        .PinNum = LED_YELLOW_PIN,
+        .ActiveType = LED_YELLOW_ACTIVETYPE,
         .LedInitState = LED_OFF,
 	},
         [LED_GREEN]=
 	{
-        .PortID = 0,
-        .PinNum = 2,
-        .ActiveType = LED_ACTIVEHIGH,
+        .PortID = LED_GREEN_PORT,
+        .PinNum = LED_GREEN_PIN,
+        .ActiveType = LED_GREEN_ACTIVETYPE,
         .LedInitState = LED_OFF,
 	},     
 
@@ -35,6 +35,21 @@ typedef enum
     _NUM_OF_LEDS
 }LEDS;
 
+/**
+ * @brief Pin of each LED, named after its ID, used by LED_Configs and the LED_*Fast() macros.
+ */
+#define LED_RED_PORT            GPIO_GPIOA
+#define LED_RED_PIN             GPIO_PIN0
+#define LED_RED_ACTIVETYPE      LED_ACTIVEHIGH
+
+#define LED_YELLOW_PORT         GPIO_GPIOA
+#define LED_YELLOW_PIN          GPIO_PIN1
+#define LED_YELLOW_ACTIVETYPE   LED_ACTIVEHIGH
+
+#define LED_GREEN_PORT          GPIO_GPIOA
+#define LED_GREEN_PIN           GPIO_PIN2
+#define LED_GREEN_ACTIVETYPE    LED_ACTIVEHIGH
+
 
 /********************************************************************************************************/
 /************************************************Types***************************************************/
@@ -14,6 +14,10 @@
 /********************************************************************************************************/
 #include "Switch.h"
 #include "MCAL/GPIO/GPIO.h"
+#include "MCAL/EXTI/EXTI.h"
+#include "MCAL/RCC/RCC.h"
+#include "Services/Scheduler/Scheduler.h"
+#include "Services/InputSnapshot/InputSnapshot.h"
 #include "assertparam.h"
 
 /********************************************************************************************************/
@@ -68,16 +72,38 @@ typedef struct
  */
 static Task_State SwitchesStates[_NUM_OF_SWITCHES];
 
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static void WakeUpTask(void);
+static GPIO_PinMode_t GetPinMode(Switch_Config_t const *SwitchConfig);
+
 /********************************************************************************************************/
 /*********************************************APIs Implementation****************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief EXTI callback of the switches pins, an edge restarts the debouncing task.
+ */
+static void WakeUpTask(void)
+{
+    Sched_signal(SWITCH_TASK_RUNNABLE_ID);
+}
+
+/**
+ * @brief Mode of the pin of a switch, set by Board_init() through Switch_getPinConfigs().
+ */
+static GPIO_PinMode_t GetPinMode(Switch_Config_t const *SwitchConfig)
+{
+    return (SwitchConfig->PUConfig == SWITCH_ENABLE_INTERNALPU) ? GPIO_MODE_INPUT_PULLUP : GPIO_MODE_INPUT_NOPULL;
+}
+
 Switch_Error_t Switch_init(void)
 {
 	Switch_Config_t  *CurrentSwitch;
-    GPIO_PinConfig_t CurrentPin;
+    Switch_Error_t RetErrorStatus = SWITCH_OK;
 
-    /* Initializing all Switches pins' direction */
+    /* Initializing all Switches states, the pins are configured by Board_init() */
     uint32_t SwitchCounter = 0;
     for(SwitchCounter = 0; SwitchCounter < (uint32_t)_NUM_OF_SWITCHES; SwitchCounter++)
     {
@@ -87,21 +113,58 @@ Switch_Error_t Switch_init(void)
         assert_param(IS_SWITCH_ACTIVE_TYPE(CurrentSwitch->ActiveType));
         assert_param(IS_SWITCH_INTERNAL_PULLUP_CONFIG(CurrentSwitch->PUConfig));
 
-        /* Set the switch pin configuration */ 
-        CurrentPin.Port		    = (GPIO_Port_t)CurrentSwitch->PortID;
-        CurrentPin.PinNumber	= (GPIO_Pin_t)CurrentSwitch->PinNum;
-        CurrentPin.PinSpeed     = GPIO_SPEED_MEDIUM;
-        CurrentPin.PinMode	    = (CurrentSwitch->PUConfig == SWITCH_ENABLE_INTERNALPU) ?
-                                    GPIO_MODE_INPUT_PULLUP : GPIO_MODE_INPUT_NOPULL; 
+        /* Switch_getPinConfigs() missing from Board_PinSources, or another module took the pin */
+        if(GPIO_getPinMode((GPIO_Port_t)CurrentSwitch->PortID, (GPIO_Pin_t)CurrentSwitch->PinNum) != GetPinMode(CurrentSwitch))
+        {
+            RetErrorStatus = SWITCH_NOK;
+        }
 
         /* Initialize task states */
         SwitchesStates[SwitchCounter].PressState = SWITCH_RELEASED;
         SwitchesStates[SwitchCounter].ConsecutiveSameStateCount = 0;
+    }
+
+    /* The debouncing task reads the pins from the snapshot, it must hold their levels before the first tick */
+    (void)InputSnapshot_init();
+
+    /* Interrupt driven task, the edges of the switches pins wake it up */
+    if(SWITCH_TASK_RUNNABLE_ID != SCHED_NO_RUNNABLE)
+    {
+        EXTI_LineConfig_t LineConfig;
+
+        RCC_enableAPB2Peripheral(RCC_APB2PERIPHERAL_SYSCFG);
 
-        GPIO_initPin(&CurrentPin);
+        for(SwitchCounter = 0; SwitchCounter < (uint32_t)_NUM_OF_SWITCHES; SwitchCounter++)
+        {
+            LineConfig.Port     = (GPIO_Port_t)Switch_Configs[SwitchCounter].PortID;
+            LineConfig.Line     = (EXTI_Line_t)Switch_Configs[SwitchCounter].PinNum;
+            LineConfig.Edge     = EXTI_EDGE_BOTH;
+            LineConfig.CallBack = WakeUpTask;
+            EXTI_initLine(&LineConfig);
+        }
+    }
+
+	return RetErrorStatus;
+}
+
+uint32_t Switch_getPinConfigs(GPIO_PinConfig_t *PinConfigs, uint32_t MaxPins)
+{
+	Switch_Config_t  *CurrentSwitch;
+
+    assert_param(PinConfigs || (MaxPins == 0));
+
+    uint32_t SwitchCounter = 0;
+    for(SwitchCounter = 0; (SwitchCounter < (uint32_t)_NUM_OF_SWITCHES) && (SwitchCounter < MaxPins); SwitchCounter++)
+    {
+        CurrentSwitch = &(Switch_Configs[SwitchCounter]);
+
+        PinConfigs[SwitchCounter].Port		    = (GPIO_Port_t)CurrentSwitch->PortID;
+        PinConfigs[SwitchCounter].PinNumber	    = (GPIO_Pin_t)CurrentSwitch->PinNum;
+        PinConfigs[SwitchCounter].PinSpeed      = GPIO_SPEED_MEDIUM;
+        PinConfigs[SwitchCounter].PinMode	    = GetPinMode(CurrentSwitch);
     }
-	
-	return SWITCH_OK;
+
+	return _NUM_OF_SWITCHES;
 }
 
 Switch_StateType_t Switch_getSwitchState(uint32_t SwitchID)
@@ -121,9 +184,14 @@ Switch_StateType_t Switch_getSwitchState(uint32_t SwitchID)
 
 void Switch_Task_CheckState(void)
 {
+    uint32_t AllStable = 1;
+
+    /* Sampling from the snapshot of the tick, every switch is read at the same instant */
     for(uint8_t SwitchCounter = 0; SwitchCounter <  (uint32_t)_NUM_OF_SWITCHES; SwitchCounter++)
     {
-        Switch_StateType_t CurrentSwitchState = Switch_getSwitchState(SwitchCounter);
+        GPIO_PinState_t PinRead = InputSnapshot_getPinValue((GPIO_Port_t)Switch_Configs[SwitchCounter].PortID,
+                                                            (GPIO_Pin_t)Switch_Configs[SwitchCounter].PinNum);
+        Switch_StateType_t CurrentSwitchState = (Switch_StateType_t)PinRead ^ (Switch_StateType_t)Switch_Configs[SwitchCounter].ActiveType;
 
         if(CurrentSwitchState != SwitchesStates[SwitchCounter].PressState)
         {
@@ -137,9 +205,16 @@ void Switch_Task_CheckState(void)
         if(SwitchesStates[SwitchCounter].ConsecutiveSameStateCount == SWITCH_CONSECUTIVE_SAME_STATE_THRESHOLD)
         {
             SwitchesStates[SwitchCounter].PressState = CurrentSwitchState;
+            SwitchesStates[SwitchCounter].ConsecutiveSameStateCount = 0;
         }
 
-        
+        AllStable &= (SwitchesStates[SwitchCounter].ConsecutiveSameStateCount == 0);
+    }
+
+    /* Nothing to debounce, the task is signaled again by the next edge */
+    if((SWITCH_TASK_RUNNABLE_ID != SCHED_NO_RUNNABLE) && AllStable)
+    {
+        Sched_suspend(SWITCH_TASK_RUNNABLE_ID);
     }
 }
 
@@ -17,6 +17,7 @@
 /********************************************************************************************************/
 #include <stdint.h>
 #include "Switch_cfg.h"
+#include "MCAL/GPIO/GPIO_Pin.h"
 
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
@@ -70,7 +71,8 @@ extern Switch_Config_t Switch_Configs[_NUM_OF_SWITCHES];
 /**
  * @brief Initialize Switch configurations based on Switch_Configs array.
  * @note The Switch_Configs array must be properly configured before calling this function.
- * @return Switch_Error_t Error status after initialization.
+ * @note The pins must have been configured by Board_init() first. It initializes the input snapshot.
+ * @return Switch_Error_t SWITCH_NOK if a pin is not in the mode of its switch.
  */
 Switch_Error_t Switch_init(void);
 
@@ -88,6 +90,11 @@ Switch_StateType_t Switch_getSwitchState(uint32_t SwitchID);
  * This function is responsible for periodically checking the state of switches
  * and performing any necessary actions based on the switch state. It should be
  * called periodically by the scheduler to ensure timely switch state updates.
+ * 
+ * @note The pins are read from the input snapshot of the tick, InputSnapshot_init() must have been
+ * called and INPUTSNAPSHOT_PORTS_MASK must include the ports of the switches.
+ * @note When SWITCH_TASK_RUNNABLE_ID names a runnable, the task suspends itself while every
+ * switch is stable and the EXTI interrupt of the switches pins resumes it.
  */
 void Switch_Task_CheckState(void);
 
@@ -105,5 +112,21 @@ void Switch_Task_CheckState(void);
  */
 Switch_StateType_t Switch_getSwitchStateAsync(uint32_t SwitchID);
 
+/**
+ * @brief List the configuration of the Switches pins, used by Board_init().
+ * @param PinConfigs Array receiving the configurations.
+ * @param MaxPins Size of PinConfigs, the configurations that do not fit are not written.
+ * @return uint32_t Number of pin configurations of the Switches.
+ */
+uint32_t Switch_getPinConfigs(GPIO_PinConfig_t *PinConfigs, uint32_t MaxPins);
+
+/**
+ * @brief Get the raw (not debounced) state of a Switch known at build time, compiles to a single IDR load.
+ * @param SwitchID ID of the Switch spelled as in SWITCHES (e.g. SWITCH_LEDTOGGLE), a variable is not accepted.
+ * @return Switch_StateType_t State of the Switch.
+ */
+#define Switch_getSwitchStateFast(SwitchID) \
+    ((Switch_StateType_t)(GPIO_pinRead(GPIO_PIN_HANDLE(SwitchID##_PORT, SwitchID##_PIN)) ^ SwitchID##_ACTIVETYPE))
+
 
 #endif /* HAL_SWITCH_SWITCH_H_ */
@@ -13,9 +13,9 @@
  {
 	 [SWITCH_LEDTOGGLE]=
 	 {
-        .PortID = 0,
-        .PinNum = 3,
-        .ActiveType = SWITCH_ACTIVELOW,
+        .PortID = SWITCH_LEDTOGGLE_PORT,
+        .PinNum = SWITCH_LEDTOGGLE_PIN,
+        .ActiveType = SWITCH_LEDTOGGLE_ACTIVETYPE,
         .PUConfig = SWITCH_ENABLE_INTERNALPU
 	 },
 
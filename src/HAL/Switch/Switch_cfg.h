@@ -4,12 +4,21 @@
 /********************************************************************************************************/
 /************************************************Includes************************************************/
 /********************************************************************************************************/
+#include "Services/Scheduler/Scheduler.h"
+#include "Services/Scheduler/Scheduler_cfg.h"
 
 
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief Scheduler runnable executing Switch_Task_CheckState(). When set, the task suspends itself once
+ *        every switch is stable and is signaled by the EXTI interrupt of the switches pins.
+ *        SCHED_NO_RUNNABLE keeps the task polling, the pin of SWITCH_LEDTOGGLE is shared with the LCD
+ *        data bus on this board.
+ */
+#define SWITCH_TASK_RUNNABLE_ID SCHED_NO_RUNNABLE
 
 
 /********************************************************************************************************/
@@ -22,6 +31,13 @@ typedef enum
     _NUM_OF_SWITCHES
 }SWITCHES;
 
+/**
+ * @brief Pin of each switch, named after its ID, used by Switch_Configs and Switch_getSwitchStateFast().
+ */
+#define SWITCH_LEDTOGGLE_PORT           GPIO_GPIOA
+#define SWITCH_LEDTOGGLE_PIN            GPIO_PIN3
+#define SWITCH_LEDTOGGLE_ACTIVETYPE     SWITCH_ACTIVELOW
+
 
 
 
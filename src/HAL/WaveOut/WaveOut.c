@@ -0,0 +1,244 @@
+/**
+ * @file WaveOut.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Implementation of the timer-paced waveform output
+ * @version 0.1
+ * @date 2024-04-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "HAL/WaveOut/WaveOut.h"
+#include "MCAL/RCC/RCC.h"
+#include "MCAL/TIM/TIM.h"
+#include "MCAL/DMA/DMA.h"
+#include <stddef.h>
+#include <string.h>
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/* TIM1 update requests are mapped to channel 6 of DMA2 Stream5 */
+#define WAVEOUT_TIMER       TIM_TIM1
+#define WAVEOUT_DMA         DMA_DMA2
+#define WAVEOUT_DMA_STREAM  DMA_STREAM5
+#define WAVEOUT_DMA_CHANNEL DMA_CHANNEL6
+
+#define NS_PER_SECOND       (1000000000ULL)
+#define MAX_TIMER_COUNTS    (0x10000ULL)
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+typedef enum
+{
+    STATE_IDLE,
+    STATE_SENDING,      /**< Single buffer output */
+    STATE_STREAMING,    /**< Double buffer output, the producer has not run dry yet */
+    STATE_DRAINING,     /**< Double buffer output, the last words are queued */
+} State_t;
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+static volatile State_t State = STATE_IDLE;
+
+static TIM_TimebaseConfig_t Timebase = {.Timer = WAVEOUT_TIMER};
+
+static WaveOut_DoneFn_t DoneCallBack;
+
+/* Double buffer output */
+static uint32_t *Buffers[2];
+static uint32_t BufferWords;
+static WaveOut_RefillFn_t RefillCallBack;
+static uint32_t BuffersLeft;    /**< Buffers to output before stopping, while draining */
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static void FillBuffer(uint32_t *Buffer, uint32_t Position);
+static void Start(DMA_Mode_t Mode, void const *Memory0, void const *Memory1, uint32_t NumOfWords);
+static void Stop(void);
+static void DmaEvent(DMA_Event_t Event);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Fills a buffer with the next words, Position being the number of buffers output until it is done.
+ */
+static void FillBuffer(uint32_t *Buffer, uint32_t Position)
+{
+    uint32_t Count = 0;
+
+    if(State == STATE_STREAMING)
+    {
+        Count = RefillCallBack(Buffer, BufferWords);
+        if(Count < BufferWords)
+        {
+            /* An empty buffer is not output at all */
+            State = STATE_DRAINING;
+            BuffersLeft = (Count > 0) ? Position : (Position - 1);
+        }
+    }
+
+    /* Leaving the port unchanged after the last word, the stream is stopped from the interrupt */
+    memset(&Buffer[Count], 0, (BufferWords - Count) * sizeof(uint32_t));
+}
+
+static void Start(DMA_Mode_t Mode, void const *Memory0, void const *Memory1, uint32_t NumOfWords)
+{
+    DMA_StreamConfig_t StreamConfig =
+    {
+        .Controller    = WAVEOUT_DMA,
+        .Stream        = WAVEOUT_DMA_STREAM,
+        .Channel       = WAVEOUT_DMA_CHANNEL,
+        .Direction     = DMA_DIR_MEM_TO_PERIPH,
+        .PeriphAddress = GPIO_getSetResetRegAddress(WAVEOUT_PORT),
+        .DataSize      = DMA_SIZE_WORD,
+        .Priority      = DMA_PRIORITY_VERY_HIGH,
+        .Mode          = Mode,
+        .CallBack      = DmaEvent,
+    };
+
+    DMA_initStream(&StreamConfig);
+    DMA_startStream(WAVEOUT_DMA, WAVEOUT_DMA_STREAM, Memory0, Memory1, NumOfWords);
+    TIM_start(WAVEOUT_TIMER);
+}
+
+static void Stop(void)
+{
+    TIM_stop(WAVEOUT_TIMER);
+    DMA_stopStream(WAVEOUT_DMA, WAVEOUT_DMA_STREAM);
+    State = STATE_IDLE;
+}
+
+static void DmaEvent(DMA_Event_t Event)
+{
+    if((Event == DMA_EVENT_ERROR) || (State == STATE_SENDING))
+    {
+        Stop();
+        if(DoneCallBack != NULL)
+        {
+            DoneCallBack();
+        }
+        return;
+    }
+
+    if(State == STATE_DRAINING)
+    {
+        BuffersLeft--;
+        if(BuffersLeft == 0)
+        {
+            /* The DMA is already replaying the buffer after the last one, which only holds idle words */
+            Stop();
+            if(DoneCallBack != NULL)
+            {
+                DoneCallBack();
+            }
+            return;
+        }
+    }
+
+    /* The buffer just output is the one the DMA switched away from, it is output again after the current one */
+    FillBuffer(Buffers[DMA_getCurrentTarget(WAVEOUT_DMA, WAVEOUT_DMA_STREAM) ^ 1UL], 2);
+}
+
+WaveOut_Error_t WaveOut_init(void)
+{
+    RCC_enableAPB2Peripheral(RCC_APB2PERIPHERAL_TIM1);
+    RCC_enableAHB1Peripheral(RCC_AHB1PERIPHERAL_DMA2);
+
+    if(WaveOut_setBitPeriod(WAVEOUT_DEFAULT_BIT_PERIOD_NS) != WAVEOUT_OK)
+    {
+        return WAVEOUT_NOK;
+    }
+    TIM_enableUpdateDMA(WAVEOUT_TIMER);
+
+    return WAVEOUT_OK;
+}
+
+WaveOut_Error_t WaveOut_setBitPeriod(uint32_t PeriodNS)
+{
+    uint64_t Counts = ((uint64_t)PeriodNS * WAVEOUT_TIMER_CLOCK_HZ) / NS_PER_SECOND;
+    uint64_t Prescaler = (Counts + MAX_TIMER_COUNTS - 1) / MAX_TIMER_COUNTS;
+
+    if((State != STATE_IDLE) || (Counts < 2) || (Prescaler > MAX_TIMER_COUNTS))
+    {
+        return WAVEOUT_NOK;
+    }
+
+    /* The smallest prescaler keeps the finest resolution */
+    Timebase.Prescaler = (uint32_t)Prescaler;
+    Timebase.Period = (uint32_t)(Counts / Prescaler);
+    TIM_initTimebase(&Timebase);
+
+    return WAVEOUT_OK;
+}
+
+WaveOut_Error_t WaveOut_send(uint32_t const *Words, uint32_t NumOfWords, WaveOut_DoneFn_t Done)
+{
+    if((State != STATE_IDLE) || (Words == NULL) || (NumOfWords == 0) || (NumOfWords > WAVEOUT_MAX_WORDS))
+    {
+        return WAVEOUT_NOK;
+    }
+
+    State = STATE_SENDING;
+    DoneCallBack = Done;
+    Start(DMA_MODE_NORMAL, Words, NULL, NumOfWords);
+
+    return WAVEOUT_OK;
+}
+
+WaveOut_Error_t WaveOut_stream(uint32_t *Buffer0, uint32_t *Buffer1, uint32_t NumOfWords, WaveOut_RefillFn_t Refill, WaveOut_DoneFn_t Done)
+{
+    if((State != STATE_IDLE) || (Buffer0 == NULL) || (Buffer1 == NULL) || (Refill == NULL) ||
+       (NumOfWords == 0) || (NumOfWords > WAVEOUT_MAX_WORDS))
+    {
+        return WAVEOUT_NOK;
+    }
+
+    Buffers[0] = Buffer0;
+    Buffers[1] = Buffer1;
+    BufferWords = NumOfWords;
+    RefillCallBack = Refill;
+    DoneCallBack = Done;
+
+    State = STATE_STREAMING;
+    FillBuffer(Buffer0, 1);
+    FillBuffer(Buffer1, 2);
+
+    if((State == STATE_DRAINING) && (BuffersLeft == 0))
+    {
+        State = STATE_IDLE;
+        if(DoneCallBack != NULL)
+        {
+            DoneCallBack();
+        }
+        return WAVEOUT_OK;
+    }
+
+    Start(DMA_MODE_DOUBLE_BUFFER, Buffer0, Buffer1, NumOfWords);
+
+    return WAVEOUT_OK;
+}
+
+WaveOut_Error_t WaveOut_abort(void)
+{
+    Stop();
+    return WAVEOUT_OK;
+}
+
+uint32_t WaveOut_isBusy(void)
+{
+    return (State != STATE_IDLE) ? 1 : 0;
+}
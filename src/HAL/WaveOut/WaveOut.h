@@ -0,0 +1,136 @@
+/**
+ * @file WaveOut.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Timer-paced waveform output, streams BSRR words into a GPIO port without the CPU
+ * @version 0.1
+ * @date 2024-04-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Each update event of TIM1 requests DMA2 Stream5 (channel 6) to move the next 32-bit word of a
+ * buffer into the BSRR of WAVEOUT_PORT, so the pins change once per bit period whatever the CPU is
+ * doing. A word sets the pins of its low half and resets the pins of its high half, zero leaves the
+ * port unchanged.
+ * 
+ * The pins must have been configured as outputs beforehand. The buffers are read by the DMA while
+ * the waveform is output: they must stay valid and unchanged until the completion callback, and
+ * in the host build they must be statically allocated (the simulated DMA only sees 32-bit addresses).
+ */
+#ifndef HAL_WAVEOUT_WAVEOUT_H_
+#define HAL_WAVEOUT_WAVEOUT_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "HAL/WaveOut/WaveOut_cfg.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Word driving the pins of @p SetPins high and the ones of @p ResetPins low, bit n is pin n.
+ */
+#define WAVEOUT_WORD(SetPins, ResetPins) ((uint32_t)(uint16_t)(SetPins) | ((uint32_t)(uint16_t)(ResetPins) << 16))
+
+/**
+ * @brief Word leaving the port unchanged for one bit period.
+ */
+#define WAVEOUT_IDLE (0UL)
+
+/**
+ * @brief Maximum number of words of a buffer.
+ */
+#define WAVEOUT_MAX_WORDS (0xFFFFUL)
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enumeration for the error status of the waveform output.
+ */
+typedef enum
+{
+    WAVEOUT_OK,      /**< Operation successful */
+    WAVEOUT_NOK      /**< Operation not successful */
+} WaveOut_Error_t;
+
+/**
+ * @brief Callback executed from the DMA interrupt once the last word has been written to the port.
+ */
+typedef void (*WaveOut_DoneFn_t)(void);
+
+/**
+ * @brief Callback executed from the DMA interrupt to produce the next words of a stream.
+ * 
+ * Fills @p Buffer with up to @p NumOfWords words and returns how many it wrote, fewer than
+ * @p NumOfWords ends the stream after these words. It must return before the DMA has gone through
+ * the other buffer, which takes NumOfWords bit periods.
+ */
+typedef uint32_t (*WaveOut_RefillFn_t)(uint32_t *Buffer, uint32_t NumOfWords);
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enables TIM1 and DMA2 and sets the bit period to WAVEOUT_DEFAULT_BIT_PERIOD_NS.
+ * 
+ * @return WAVEOUT_OK on success, WAVEOUT_NOK if the default period can not be generated.
+ */
+WaveOut_Error_t WaveOut_init(void);
+
+/**
+ * @brief Sets the time between two words, rounded down to the period of the timer clock.
+ * 
+ * @param PeriodNS Bit period in nanoseconds, at least two timer clock periods.
+ * @return WAVEOUT_OK on success, WAVEOUT_NOK while a waveform is output or if the period is out of range.
+ */
+WaveOut_Error_t WaveOut_setBitPeriod(uint32_t PeriodNS);
+
+/**
+ * @brief Outputs a buffer of words, one per bit period, the first one a bit period after the call.
+ * 
+ * @param Words Words to write to the port.
+ * @param NumOfWords Number of words, 1 to WAVEOUT_MAX_WORDS.
+ * @param Done Function called once the last word has been written, may be NULL.
+ * @return WAVEOUT_OK on success, WAVEOUT_NOK while a waveform is output or if the parameters are invalid.
+ */
+WaveOut_Error_t WaveOut_send(uint32_t const *Words, uint32_t NumOfWords, WaveOut_DoneFn_t Done);
+
+/**
+ * @brief Outputs a waveform of any length through two buffers, one being refilled while the other is output.
+ * 
+ * Both buffers are filled by @p Refill before the output starts, then each buffer is refilled as soon
+ * as it has been output. The words missing from the last buffer are output as WAVEOUT_IDLE.
+ * 
+ * @param Buffer0 First buffer of NumOfWords words.
+ * @param Buffer1 Second buffer of NumOfWords words.
+ * @param NumOfWords Number of words of each buffer, 1 to WAVEOUT_MAX_WORDS.
+ * @param Refill Producer of the words.
+ * @param Done Function called once the last word has been written, may be NULL. It is called before
+ *        returning when @p Refill produces nothing.
+ * @return WAVEOUT_OK on success, WAVEOUT_NOK while a waveform is output or if the parameters are invalid.
+ */
+WaveOut_Error_t WaveOut_stream(uint32_t *Buffer0, uint32_t *Buffer1, uint32_t NumOfWords, WaveOut_RefillFn_t Refill, WaveOut_DoneFn_t Done);
+
+/**
+ * @brief Stops the output immediately, the completion callback is not called.
+ * 
+ * @return WAVEOUT_OK.
+ */
+WaveOut_Error_t WaveOut_abort(void);
+
+/**
+ * @brief Tells whether a waveform is being output.
+ * 
+ * @return 1 until the completion callback has been called, 0 otherwise.
+ */
+uint32_t WaveOut_isBusy(void);
+
+
+#endif // HAL_WAVEOUT_WAVEOUT_H_
@@ -0,0 +1,41 @@
+/**
+ * @file WaveOut_cfg.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Configuration of the timer-paced GPIO waveform output
+ * @version 0.1
+ * @date 2024-04-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef HAL_WAVEOUT_WAVEOUT_CFG_H_
+#define HAL_WAVEOUT_WAVEOUT_CFG_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "MCAL/GPIO/GPIO.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Port whose BSRR receives the words, the LCD bus is on GPIOA on this board.
+ */
+#define WAVEOUT_PORT GPIO_GPIOA
+
+/**
+ * @brief Clock of TIM1 in Hz: the APB2 clock, doubled when the APB2 prescaler divides it.
+ *        The board runs from the 16 MHz HSI with no prescaler.
+ */
+#define WAVEOUT_TIMER_CLOCK_HZ 16000000UL
+
+/**
+ * @brief Time between two words at initialization in nanoseconds, changed with WaveOut_setBitPeriod().
+ */
+#define WAVEOUT_DEFAULT_BIT_PERIOD_NS 1000UL
+
+
+#endif // HAL_WAVEOUT_WAVEOUT_CFG_H_
@@ -0,0 +1,391 @@
+/**
+ * @file DMA.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Implementation of the DMA controllers (DMA1, DMA2) streams
+ * @version 0.1
+ * @date 2024-04-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "DMA.h"
+#include "MCAL/NVIC/NVIC.h"
+#include "assertparam.h"
+#include <stddef.h>
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/************************************/
+/***************Registers************/
+/************************************/
+#define DMA1_BASE   (0x40026000UL)
+#define DMA2_BASE   (0x40026400UL)
+
+#define SxCR_EN         (1UL << 0)
+#define SxCR_DMEIE      (1UL << 1)
+#define SxCR_TEIE       (1UL << 2)
+#define SxCR_TCIE       (1UL << 4)
+#define SxCR_DIR_POS    (6)
+#define SxCR_CIRC       (1UL << 8)
+#define SxCR_MINC       (1UL << 10)
+#define SxCR_PSIZE_POS  (11)
+#define SxCR_MSIZE_POS  (13)
+#define SxCR_PL_POS     (16)
+#define SxCR_DBM        (1UL << 18)
+#define SxCR_CT         (1UL << 19)
+#define SxCR_CHSEL_POS  (25)
+
+/* Flags of a stream in LISR/HISR and LIFCR/HIFCR, shifted by the position of the stream */
+#define FLAG_FEIF       (1UL << 0)
+#define FLAG_DMEIF      (1UL << 2)
+#define FLAG_TEIF       (1UL << 3)
+#define FLAG_HTIF       (1UL << 4)
+#define FLAG_TCIF       (1UL << 5)
+#define FLAGS_ALL       (FLAG_FEIF | FLAG_DMEIF | FLAG_TEIF | FLAG_HTIF | FLAG_TCIF)
+
+/* Streams 0 to 3 use the low registers, 4 to 7 the high ones */
+#define STREAMS_PER_FLAG_REG (4)
+
+/************************************/
+/***************Validators***********/
+/************************************/
+#define IS_DMA_CONTROLLER(CONTROLLER) ((CONTROLLER) < _DMA_NUM_OF_CONTROLLERS)
+
+#define IS_DMA_STREAM(STREAM) ((STREAM) < _DMA_NUM_OF_STREAMS)
+
+#define IS_DMA_CHANNEL(CHANNEL) ((CHANNEL) <= DMA_CHANNEL7)
+
+#define IS_DMA_DIRECTION(CONTROLLER, DIR) (((DIR) == DMA_DIR_PERIPH_TO_MEM) || \
+                                           ((DIR) == DMA_DIR_MEM_TO_PERIPH) || \
+                                           (((DIR) == DMA_DIR_MEM_TO_MEM) && ((CONTROLLER) == DMA_DMA2)))
+
+#define IS_DMA_DATA_SIZE(SIZE) (((SIZE) == DMA_SIZE_BYTE)     || \
+                                ((SIZE) == DMA_SIZE_HALFWORD) || \
+                                ((SIZE) == DMA_SIZE_WORD))
+
+#define IS_DMA_PRIORITY(PRIORITY) ((PRIORITY) <= DMA_PRIORITY_VERY_HIGH)
+
+/* Memory to memory transfers can not be circular */
+#define IS_DMA_MODE(DIR, MODE) (((MODE) == DMA_MODE_NORMAL) || \
+                                ((((MODE) == DMA_MODE_CIRCULAR) || ((MODE) == DMA_MODE_DOUBLE_BUFFER)) && ((DIR) != DMA_DIR_MEM_TO_MEM)))
+
+#define IS_DMA_NUM_OF_DATA(NUM) (((NUM) > 0) && ((NUM) <= DMA_MAX_NUM_OF_DATA))
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Structure representing the registers of a stream.
+ */
+typedef struct
+{
+    uint32_t CR;        /**< Stream configuration register. */
+    uint32_t NDTR;      /**< Number of data register. */
+    uint32_t PAR;       /**< Peripheral address register. */
+    uint32_t M0AR;      /**< Memory 0 address register. */
+    uint32_t M1AR;      /**< Memory 1 address register, double buffer mode. */
+    uint32_t FCR;       /**< FIFO control register. */
+} DMA_StreamRegs_t;
+
+/**
+ * @brief Structure representing the DMA controller registers.
+ */
+typedef struct
+{
+    uint32_t LISR;      /**< Low interrupt status register, streams 0 to 3. */
+    uint32_t HISR;      /**< High interrupt status register, streams 4 to 7. */
+    uint32_t LIFCR;     /**< Low interrupt flag clear register, write 1 to clear. */
+    uint32_t HIFCR;     /**< High interrupt flag clear register, write 1 to clear. */
+    DMA_StreamRegs_t S[_DMA_NUM_OF_STREAMS];
+} DMA_t;
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+static DMA_t volatile *const DMAS[_DMA_NUM_OF_CONTROLLERS] =
+{
+    [DMA_DMA1] = (DMA_t volatile *const)DMA1_BASE,
+    [DMA_DMA2] = (DMA_t volatile *const)DMA2_BASE,
+};
+
+static DMA_CallBackFn_t CallBacks[_DMA_NUM_OF_CONTROLLERS][_DMA_NUM_OF_STREAMS] = {{NULL}};
+
+/* Position of the flags of a stream in its flag registers, indexed by stream % 4 */
+static const uint8_t FlagShifts[STREAMS_PER_FLAG_REG] = {0, 6, 16, 22};
+
+static const NVIC_IRQ_t StreamIRQs[_DMA_NUM_OF_CONTROLLERS][_DMA_NUM_OF_STREAMS] =
+{
+    [DMA_DMA1] =
+    {
+        NVIC_IRQ_DMA1_STREAM0, NVIC_IRQ_DMA1_STREAM1, NVIC_IRQ_DMA1_STREAM2, NVIC_IRQ_DMA1_STREAM3,
+        NVIC_IRQ_DMA1_STREAM4, NVIC_IRQ_DMA1_STREAM5, NVIC_IRQ_DMA1_STREAM6, NVIC_IRQ_DMA1_STREAM7,
+    },
+    [DMA_DMA2] =
+    {
+        NVIC_IRQ_DMA2_STREAM0, NVIC_IRQ_DMA2_STREAM1, NVIC_IRQ_DMA2_STREAM2, NVIC_IRQ_DMA2_STREAM3,
+        NVIC_IRQ_DMA2_STREAM4, NVIC_IRQ_DMA2_STREAM5, NVIC_IRQ_DMA2_STREAM6, NVIC_IRQ_DMA2_STREAM7,
+    },
+};
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static void ClearFlags(DMA_Controller_t Controller, DMA_Stream_t Stream);
+static void HandleStream(DMA_Controller_t Controller, DMA_Stream_t Stream);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+static void ClearFlags(DMA_Controller_t Controller, DMA_Stream_t Stream)
+{
+    DMA_t volatile *const DMA = DMAS[Controller];
+    uint32_t Flags = FLAGS_ALL << FlagShifts[Stream % STREAMS_PER_FLAG_REG];
+
+    if(Stream < STREAMS_PER_FLAG_REG)
+    {
+        DMA->LIFCR = Flags;
+    }
+    else
+    {
+        DMA->HIFCR = Flags;
+    }
+}
+
+/**
+ * @brief Acknowledges the flags of a stream, then reports the event to its callback.
+ */
+static void HandleStream(DMA_Controller_t Controller, DMA_Stream_t Stream)
+{
+    DMA_t volatile *const DMA = DMAS[Controller];
+    uint32_t Shift = FlagShifts[Stream % STREAMS_PER_FLAG_REG];
+    uint32_t Flags;
+
+    if(Stream < STREAMS_PER_FLAG_REG)
+    {
+        Flags = (DMA->LISR >> Shift) & FLAGS_ALL;
+        DMA->LIFCR = Flags << Shift;
+    }
+    else
+    {
+        Flags = (DMA->HISR >> Shift) & FLAGS_ALL;
+        DMA->HIFCR = Flags << Shift;
+    }
+
+    if(CallBacks[Controller][Stream] == NULL)
+    {
+        return;
+    }
+
+    if(Flags & (FLAG_TEIF | FLAG_DMEIF))
+    {
+        CallBacks[Controller][Stream](DMA_EVENT_ERROR);
+    }
+    else if(Flags & FLAG_TCIF)
+    {
+        CallBacks[Controller][Stream](DMA_EVENT_TRANSFER_COMPLETE);
+    }
+}
+
+MCAL_Status_t DMA_initStream(DMA_StreamConfig_t const *StreamConfig)
+{
+    assert_param(StreamConfig);
+    assert_param(IS_DMA_CONTROLLER(StreamConfig->Controller));
+    assert_param(IS_DMA_STREAM(StreamConfig->Stream));
+    assert_param(IS_DMA_CHANNEL(StreamConfig->Channel));
+    assert_param(IS_DMA_DIRECTION(StreamConfig->Controller, StreamConfig->Direction));
+    assert_param(IS_DMA_DATA_SIZE(StreamConfig->DataSize));
+    assert_param(IS_DMA_PRIORITY(StreamConfig->Priority));
+    assert_param(IS_DMA_MODE(StreamConfig->Direction, StreamConfig->Mode));
+
+    DMA_StreamRegs_t volatile *const S = &DMAS[StreamConfig->Controller]->S[StreamConfig->Stream];
+    uint32_t CR;
+
+    DMA_stopStream(StreamConfig->Controller, StreamConfig->Stream);
+
+    CallBacks[StreamConfig->Controller][StreamConfig->Stream] = StreamConfig->CallBack;
+
+    CR = ((uint32_t)StreamConfig->Channel << SxCR_CHSEL_POS) |
+         ((uint32_t)StreamConfig->Priority << SxCR_PL_POS) |
+         ((uint32_t)StreamConfig->DataSize << SxCR_MSIZE_POS) |
+         ((uint32_t)StreamConfig->DataSize << SxCR_PSIZE_POS) |
+         ((uint32_t)StreamConfig->Direction << SxCR_DIR_POS) |
+         SxCR_MINC;
+
+    /* The double buffer mode implies the circular one */
+    if(StreamConfig->Mode == DMA_MODE_CIRCULAR)
+    {
+        CR |= SxCR_CIRC;
+    }
+    else if(StreamConfig->Mode == DMA_MODE_DOUBLE_BUFFER)
+    {
+        CR |= SxCR_DBM;
+    }
+
+    if(StreamConfig->CallBack != NULL)
+    {
+        CR |= SxCR_TCIE | SxCR_TEIE | SxCR_DMEIE;
+    }
+
+    S->CR = CR;
+    S->PAR = StreamConfig->PeriphAddress;
+    /* Direct mode, each request moves one data */
+    S->FCR = 0;
+
+    if(StreamConfig->CallBack != NULL)
+    {
+        NVIC_enableIRQ(StreamIRQs[StreamConfig->Controller][StreamConfig->Stream]);
+    }
+
+    return MCAL_OK;
+}
+
+MCAL_Status_t DMA_startStream(DMA_Controller_t Controller, DMA_Stream_t Stream, void const *Memory0, void const *Memory1, uint32_t NumOfData)
+{
+    assert_param(IS_DMA_CONTROLLER(Controller));
+    assert_param(IS_DMA_STREAM(Stream));
+    assert_param(Memory0);
+    assert_param(IS_DMA_NUM_OF_DATA(NumOfData));
+
+    DMA_StreamRegs_t volatile *const S = &DMAS[Controller]->S[Stream];
+
+    if(S->CR & SxCR_EN)
+    {
+        return MCAL_BUSY;
+    }
+
+    if(S->CR & SxCR_DBM)
+    {
+        assert_param(Memory1);
+        S->M1AR = (uint32_t)(uintptr_t)Memory1;
+    }
+    S->M0AR = (uint32_t)(uintptr_t)Memory0;
+    S->NDTR = NumOfData;
+
+    /* Starting from Memory0, with no stale flag to raise an interrupt */
+    ClearFlags(Controller, Stream);
+    S->CR = (S->CR & ~SxCR_CT) | SxCR_EN;
+
+    return MCAL_OK;
+}
+
+MCAL_Status_t DMA_stopStream(DMA_Controller_t Controller, DMA_Stream_t Stream)
+{
+    assert_param(IS_DMA_CONTROLLER(Controller));
+    assert_param(IS_DMA_STREAM(Stream));
+
+    DMA_StreamRegs_t volatile *const S = &DMAS[Controller]->S[Stream];
+
+    S->CR &= ~SxCR_EN;
+
+    /* EN stays set until the data in progress has been moved */
+    while(S->CR & SxCR_EN);
+
+    ClearFlags(Controller, Stream);
+    return MCAL_OK;
+}
+
+uint32_t DMA_getCurrentTarget(DMA_Controller_t Controller, DMA_Stream_t Stream)
+{
+    assert_param(IS_DMA_CONTROLLER(Controller));
+    assert_param(IS_DMA_STREAM(Stream));
+
+    return (DMAS[Controller]->S[Stream].CR & SxCR_CT) ? 1 : 0;
+}
+
+uint32_t DMA_getRemainingData(DMA_Controller_t Controller, DMA_Stream_t Stream)
+{
+    assert_param(IS_DMA_CONTROLLER(Controller));
+    assert_param(IS_DMA_STREAM(Stream));
+
+    return DMAS[Controller]->S[Stream].NDTR;
+}
+
+void DMA1_Stream0_IRQHandler(void)
+{
+    HandleStream(DMA_DMA1, DMA_STREAM0);
+}
+
+void DMA1_Stream1_IRQHandler(void)
+{
+    HandleStream(DMA_DMA1, DMA_STREAM1);
+}
+
+void DMA1_Stream2_IRQHandler(void)
+{
+    HandleStream(DMA_DMA1, DMA_STREAM2);
+}
+
+void DMA1_Stream3_IRQHandler(void)
+{
+    HandleStream(DMA_DMA1, DMA_STREAM3);
+}
+
+void DMA1_Stream4_IRQHandler(void)
+{
+    HandleStream(DMA_DMA1, DMA_STREAM4);
+}
+
+void DMA1_Stream5_IRQHandler(void)
+{
+    HandleStream(DMA_DMA1, DMA_STREAM5);
+}
+
+void DMA1_Stream6_IRQHandler(void)
+{
+    HandleStream(DMA_DMA1, DMA_STREAM6);
+}
+
+void DMA1_Stream7_IRQHandler(void)
+{
+    HandleStream(DMA_DMA1, DMA_STREAM7);
+}
+
+void DMA2_Stream0_IRQHandler(void)
+{
+    HandleStream(DMA_DMA2, DMA_STREAM0);
+}
+
+void DMA2_Stream1_IRQHandler(void)
+{
+    HandleStream(DMA_DMA2, DMA_STREAM1);
+}
+
+void DMA2_Stream2_IRQHandler(void)
+{
+    HandleStream(DMA_DMA2, DMA_STREAM2);
+}
+
+void DMA2_Stream3_IRQHandler(void)
+{
+    HandleStream(DMA_DMA2, DMA_STREAM3);
+}
+
+void DMA2_Stream4_IRQHandler(void)
+{
+    HandleStream(DMA_DMA2, DMA_STREAM4);
+}
+
+void DMA2_Stream5_IRQHandler(void)
+{
+    HandleStream(DMA_DMA2, DMA_STREAM5);
+}
+
+void DMA2_Stream6_IRQHandler(void)
+{
+    HandleStream(DMA_DMA2, DMA_STREAM6);
+}
+
+void DMA2_Stream7_IRQHandler(void)
+{
+    HandleStream(DMA_DMA2, DMA_STREAM7);
+}
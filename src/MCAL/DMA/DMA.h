@@ -0,0 +1,205 @@
+/**
+ * @file DMA.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Header file for the DMA controllers (DMA1, DMA2) streams
+ * @version 0.1
+ * @date 2024-04-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef MCAL_DMA_DMA_H_
+#define MCAL_DMA_DMA_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "MCAL/stm32f401.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Maximum number of data moved by one transfer (NDTR is 16 bits wide).
+ */
+#define DMA_MAX_NUM_OF_DATA 0xFFFFUL
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enumeration for the DMA controllers.
+ */
+typedef enum
+{
+    DMA_DMA1,
+    DMA_DMA2,
+    _DMA_NUM_OF_CONTROLLERS,    /**< Total number of controllers ^^DO NOT MODIFY^^ */
+} DMA_Controller_t;
+
+/**
+ * @brief Enumeration for the streams of a controller.
+ */
+typedef enum
+{
+    DMA_STREAM0,
+    DMA_STREAM1,
+    DMA_STREAM2,
+    DMA_STREAM3,
+    DMA_STREAM4,
+    DMA_STREAM5,
+    DMA_STREAM6,
+    DMA_STREAM7,
+    _DMA_NUM_OF_STREAMS,    /**< Total number of streams per controller ^^DO NOT MODIFY^^ */
+} DMA_Stream_t;
+
+/**
+ * @brief Enumeration for the request channels of a stream, see the request mapping of the reference manual.
+ */
+typedef enum
+{
+    DMA_CHANNEL0,
+    DMA_CHANNEL1,
+    DMA_CHANNEL2,
+    DMA_CHANNEL3,
+    DMA_CHANNEL4,
+    DMA_CHANNEL5,
+    DMA_CHANNEL6,
+    DMA_CHANNEL7,
+} DMA_Channel_t;
+
+/**
+ * @brief Enumeration for the transfer directions.
+ */
+typedef enum
+{
+    DMA_DIR_PERIPH_TO_MEM = 0x0UL,  /**< Peripheral register to memory */
+    DMA_DIR_MEM_TO_PERIPH = 0x1UL,  /**< Memory to peripheral register */
+    DMA_DIR_MEM_TO_MEM    = 0x2UL,  /**< Memory to memory, DMA2 only, the peripheral address is the source */
+} DMA_Direction_t;
+
+/**
+ * @brief Enumeration for the size of the data moved by each request.
+ */
+typedef enum
+{
+    DMA_SIZE_BYTE     = 0x0UL,
+    DMA_SIZE_HALFWORD = 0x1UL,
+    DMA_SIZE_WORD     = 0x2UL,
+} DMA_DataSize_t;
+
+/**
+ * @brief Enumeration for the priority of a stream among the streams of its controller.
+ */
+typedef enum
+{
+    DMA_PRIORITY_LOW       = 0x0UL,
+    DMA_PRIORITY_MEDIUM    = 0x1UL,
+    DMA_PRIORITY_HIGH      = 0x2UL,
+    DMA_PRIORITY_VERY_HIGH = 0x3UL,
+} DMA_Priority_t;
+
+/**
+ * @brief Enumeration for the transfer modes.
+ */
+typedef enum
+{
+    DMA_MODE_NORMAL,        /**< The stream stops after NumOfData data */
+    DMA_MODE_CIRCULAR,      /**< The stream restarts from the start of the buffer after NumOfData data */
+    DMA_MODE_DOUBLE_BUFFER, /**< The stream alternates between two buffers of NumOfData data */
+} DMA_Mode_t;
+
+/**
+ * @brief Enumeration for the events reported to the callback of a stream.
+ */
+typedef enum
+{
+    DMA_EVENT_TRANSFER_COMPLETE,    /**< NumOfData data moved, in double buffer mode the other buffer is now in use */
+    DMA_EVENT_ERROR,                /**< Bus or direct mode error, the stream has been disabled by the hardware */
+} DMA_Event_t;
+
+/**
+ * @brief Callback executed from the interrupt handler of the stream.
+ */
+typedef void (*DMA_CallBackFn_t)(DMA_Event_t Event);
+
+/**
+ * @brief Structure for the configuration of a stream.
+ * 
+ * The memory address is incremented after each data and the peripheral one is fixed. The FIFO is
+ * not used (direct mode), so the memory and the peripheral data have the same size.
+ */
+typedef struct
+{
+    DMA_Controller_t Controller;    /**< DMA controller */
+    DMA_Stream_t     Stream;        /**< Stream of the controller */
+    DMA_Channel_t    Channel;       /**< Request channel, selects the peripheral triggering the transfers */
+    DMA_Direction_t  Direction;     /**< Transfer direction */
+    uint32_t         PeriphAddress; /**< Address of the peripheral register */
+    DMA_DataSize_t   DataSize;      /**< Size of each data */
+    DMA_Priority_t   Priority;      /**< Priority of the stream */
+    DMA_Mode_t       Mode;          /**< Transfer mode */
+    DMA_CallBackFn_t CallBack;      /**< Function called on the events of the stream, may be NULL */
+} DMA_StreamConfig_t;
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Configures a stream, the stream is disabled first and left disabled.
+ * 
+ * Enables the transfer complete and error interrupts of the stream when it has a callback.
+ * 
+ * @param StreamConfig Configuration of the stream.
+ * @note The clock of the controller must be enabled beforehand.
+ * @return Status indicating the success or failure of the initialization @ref MCAL_Status_t.
+ */
+MCAL_Status_t DMA_initStream(DMA_StreamConfig_t const *StreamConfig);
+
+/**
+ * @brief Starts a transfer on a configured stream, the peripheral requests then pace it.
+ * 
+ * @param Controller The DMA controller.
+ * @param Stream The stream.
+ * @param Memory0 First memory buffer.
+ * @param Memory1 Second memory buffer in double buffer mode, ignored otherwise.
+ * @param NumOfData Number of data of each buffer, 1 to DMA_MAX_NUM_OF_DATA.
+ * @return MCAL_BUSY when the stream is still enabled, the status of the operation otherwise @ref MCAL_Status_t.
+ */
+MCAL_Status_t DMA_startStream(DMA_Controller_t Controller, DMA_Stream_t Stream, void const *Memory0, void const *Memory1, uint32_t NumOfData);
+
+/**
+ * @brief Disables a stream, waiting for the data in progress to be moved, and clears its flags.
+ * 
+ * @param Controller The DMA controller.
+ * @param Stream The stream.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t DMA_stopStream(DMA_Controller_t Controller, DMA_Stream_t Stream);
+
+/**
+ * @brief Returns the buffer in use by a stream in double buffer mode, 0 for Memory0 and 1 for Memory1.
+ * 
+ * @param Controller The DMA controller.
+ * @param Stream The stream.
+ * @return The index of the buffer being transferred.
+ */
+uint32_t DMA_getCurrentTarget(DMA_Controller_t Controller, DMA_Stream_t Stream);
+
+/**
+ * @brief Returns the number of data left to move in the current buffer.
+ * 
+ * @param Controller The DMA controller.
+ * @param Stream The stream.
+ * @return The number of data left, zero once a normal mode transfer has completed.
+ */
+uint32_t DMA_getRemainingData(DMA_Controller_t Controller, DMA_Stream_t Stream);
+
+
+#endif // MCAL_DMA_DMA_H_
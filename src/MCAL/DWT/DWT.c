@@ -0,0 +1,107 @@
+/**
+ * @file DWT.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Implementation of the DWT (Data Watchpoint and Trace) cycle counter
+ * @version 0.1
+ * @date 2024-04-02
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "MCAL/DWT/DWT.h"
+
+#ifdef HOST_BUILD
+#include <time.h>
+
+/* Provided by host/Sim */
+uint64_t Sim_getTimeCycles(void);
+void Sim_advanceCycles(uint64_t Cycles);
+#endif
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define DEMCR_TRCENA_MASK       (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_MASK (1UL << 0)
+
+/************************************/
+/***************Registers************/
+/************************************/
+#define DWT_BASE   (0xE0001000UL)
+#define DEMCR_ADDR (0xE000EDFCUL)
+
+#define DWT     ((DWT_t volatile* const)(DWT_BASE))
+#define DEMCR   (*(uint32_t volatile* const)(DEMCR_ADDR))
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Structure representing the first DWT registers.
+ */
+typedef struct
+{
+    uint32_t CTRL;      /**< Control register. */
+    uint32_t CYCCNT;    /**< Cycle count register. */
+} DWT_t;
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+#ifdef HOST_BUILD
+
+void DWT_init(void)
+{
+}
+
+uint32_t DWT_getCycleCount(void)
+{
+    /* Whole seconds and remainder converted apart, the product overflows after about 1150 s of simulated time */
+    uint64_t SimCycles = Sim_getTimeCycles();
+    uint64_t SimTimeNS = ((SimCycles / DWT_CORE_CLOCK_HZ) * 1000000000ULL) +
+                         (((SimCycles % DWT_CORE_CLOCK_HZ) * 1000000000ULL) / DWT_CORE_CLOCK_HZ);
+
+#if DWT_HOST_CLOCK_ENABLED
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    SimTimeNS += ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+#endif
+
+    return (uint32_t)SimTimeNS;
+}
+
+#else
+
+void DWT_init(void)
+{
+    /* The counter is shared by every user, it is never reset so their running measurements stay valid */
+    DEMCR |= DEMCR_TRCENA_MASK;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_MASK;
+}
+
+uint32_t DWT_getCycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+
+#endif
+
+void DWT_delayCycles(uint32_t Cycles)
+{
+#if defined(HOST_BUILD) && !DWT_HOST_CLOCK_ENABLED
+    /* Nothing else moves the simulated time forward, rounded up to whole core cycles */
+    Sim_advanceCycles((((uint64_t)Cycles * DWT_CORE_CLOCK_HZ) + DWT_CLOCK_HZ - 1ULL) / DWT_CLOCK_HZ);
+#else
+    uint32_t StartCycles = DWT_getCycleCount();
+
+    /* Unsigned subtraction, the counter may wrap around during the wait */
+    while((DWT_getCycleCount() - StartCycles) < Cycles)
+    {
+    }
+#endif
+}
@@ -0,0 +1,91 @@
+/**
+ * @file DWT.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Header file for the DWT (Data Watchpoint and Trace) cycle counter
+ * @version 0.1
+ * @date 2024-04-02
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef MCAL_DWT_DWT_H_
+#define MCAL_DWT_DWT_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Frequency of the core clock (HSI).
+ */
+#define DWT_CORE_CLOCK_HZ 16000000UL
+
+/**
+ * @brief Frequency of the cycle counter, the core clock. In a HOST_BUILD the counter counts nanoseconds.
+ */
+#ifdef HOST_BUILD
+#define DWT_CLOCK_HZ 1000000000UL
+#else
+#define DWT_CLOCK_HZ DWT_CORE_CLOCK_HZ
+#endif
+
+/**
+ * @brief In a HOST_BUILD, adds the host monotonic clock to the simulated time counted by the counter.
+ * 
+ * Set to 0 to count the simulated time only, DWT_delayCycles() then advances the simulated time instead of
+ * spinning, so the measured durations no longer depend on the load of the host.
+ */
+#ifndef DWT_HOST_CLOCK_ENABLED
+#define DWT_HOST_CLOCK_ENABLED 1
+#endif
+
+/**
+ * @brief Converts a duration in nanoseconds to cycles of the counter, rounded up.
+ */
+#define DWT_NS_TO_CYCLES(TimeNS) ((uint32_t)((((uint64_t)(TimeNS) * (DWT_CLOCK_HZ / 1000000UL)) + 999UL) / 1000UL))
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enables the trace unit and starts the DWT cycle counter.
+ * 
+ * Every module using the counter may call it, the counter keeps its value when it is already running.
+ */
+void DWT_init(void);
+
+/**
+ * @brief Retrieves the current value of the free-running cycle counter.
+ * 
+ * The counter wraps around, so durations must be computed with unsigned subtraction.
+ * 
+ * @return The number of core clock cycles counted since the counter was first started.
+ * @note In a HOST_BUILD the value counts the nanoseconds of the host monotonic clock plus the simulated
+ *       time of host/Sim, so waits spanning several simulated ticks behave as on the target.
+ */
+uint32_t DWT_getCycleCount(void);
+
+/**
+ * @brief Busy-waits for at least the given number of cycles, see DWT_NS_TO_CYCLES().
+ * 
+ * @param Cycles Number of cycles to wait.
+ * @note DWT_init() must have been called.
+ */
+void DWT_delayCycles(uint32_t Cycles);
+
+
+
+#endif // MCAL_DWT_DWT_H_
@@ -0,0 +1,257 @@
+/**
+ * @file EXTI.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Implementation of the External Interrupt/event controller (GPIO lines)
+ * @version 0.1
+ * @date 2024-04-09
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "EXTI.h"
+#include "MCAL/NVIC/NVIC.h"
+#include "assertparam.h"
+#include <stddef.h>
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/************************************/
+/***************Registers************/
+/************************************/
+#define EXTI_BASE       (0x40013C00UL)
+#define SYSCFG_BASE     (0x40013800UL)
+
+#define EXTI            ((EXTI_t volatile* const)(EXTI_BASE))
+#define SYSCFG          ((SYSCFG_t volatile* const)(SYSCFG_BASE))
+
+#define MASK_1BIT       (0x1UL)
+#define MASK_4BITS      (0xFUL)
+
+/* SYSCFG_EXTICR: 4 lines per register, 4 bits per line */
+#define EXTICR_LINES_PER_REG    (4UL)
+#define EXTICR_BITS_PER_LINE    (4UL)
+
+/* Lines sharing the EXTI9_5 and EXTI15_10 interrupts */
+#define EXTI_LINES_9_5_MASK     (0x03E0UL)
+#define EXTI_LINES_15_10_MASK   (0xFC00UL)
+
+/************************************/
+/***************Validators***********/
+/************************************/
+#define IS_EXTI_LINE(LINE) ((LINE) < _EXTI_NUM_OF_LINES)
+
+#define IS_EXTI_EDGE(EDGE) (((EDGE) == EXTI_EDGE_RISING)  || \
+                            ((EDGE) == EXTI_EDGE_FALLING) || \
+                            ((EDGE) == EXTI_EDGE_BOTH))
+
+#define IS_EXTI_PORT(PORT) (((PORT) == GPIO_GPIOA) || \
+                            ((PORT) == GPIO_GPIOB) || \
+                            ((PORT) == GPIO_GPIOC) || \
+                            ((PORT) == GPIO_GPIOD) || \
+                            ((PORT) == GPIO_GPIOE) || \
+                            ((PORT) == GPIO_GPIOH))
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Structure representing the EXTI registers.
+ */
+typedef struct
+{
+    uint32_t IMR;       /**< Interrupt mask register. */
+    uint32_t EMR;       /**< Event mask register. */
+    uint32_t RTSR;      /**< Rising trigger selection register. */
+    uint32_t FTSR;      /**< Falling trigger selection register. */
+    uint32_t SWIER;     /**< Software interrupt event register. */
+    uint32_t PR;        /**< Pending register, write 1 to clear. */
+} EXTI_t;
+
+/**
+ * @brief Structure representing the SYSCFG registers.
+ */
+typedef struct
+{
+    uint32_t MEMRMP;    /**< Memory remap register. */
+    uint32_t PMC;       /**< Peripheral mode configuration register. */
+    uint32_t EXTICR[4]; /**< External interrupt configuration registers. */
+    uint32_t RESERVED[2];
+    uint32_t CMPCR;     /**< Compensation cell control register. */
+} SYSCFG_t;
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+static EXTI_CallBackFn_t CallBacks[_EXTI_NUM_OF_LINES] = {NULL};
+
+/* SYSCFG_EXTICR code of each port, indexed by GPIO_Port_t */
+static const uint8_t PortCodes[] =
+{
+    [GPIO_GPIOA] = 0x0,
+    [GPIO_GPIOB] = 0x1,
+    [GPIO_GPIOC] = 0x2,
+    [GPIO_GPIOD] = 0x3,
+    [GPIO_GPIOE] = 0x4,
+    [GPIO_GPIOH] = 0x7,
+};
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static NVIC_IRQ_t getLineIRQ(EXTI_Line_t Line);
+static void HandleLines(uint32_t LinesMask);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+static NVIC_IRQ_t getLineIRQ(EXTI_Line_t Line)
+{
+    NVIC_IRQ_t IRQ;
+
+    if(Line <= EXTI_LINE4)
+    {
+        IRQ = (NVIC_IRQ_t)(NVIC_IRQ_EXTI0 + Line);
+    }
+    else if(Line <= EXTI_LINE9)
+    {
+        IRQ = NVIC_IRQ_EXTI9_5;
+    }
+    else
+    {
+        IRQ = NVIC_IRQ_EXTI15_10;
+    }
+    return IRQ;
+}
+
+/**
+ * @brief Acknowledges the pending lines among LinesMask, then runs their callbacks.
+ */
+static void HandleLines(uint32_t LinesMask)
+{
+    /* PR also latches the edges of masked lines, they are left to EXTI_enableLine() */
+    uint32_t Pending = EXTI->PR & EXTI->IMR & LinesMask;
+    uint32_t Line;
+
+    /* Acknowledging first, an edge occurring during the callback triggers the interrupt again */
+    EXTI->PR = Pending;
+
+    for(Line = 0; Pending; Line++)
+    {
+        if(Pending & (MASK_1BIT << Line))
+        {
+            Pending &= ~(MASK_1BIT << Line);
+            if(CallBacks[Line] != NULL)
+            {
+                CallBacks[Line]();
+            }
+        }
+    }
+}
+
+MCAL_Status_t EXTI_initLine(EXTI_LineConfig_t const *LineConfig)
+{
+    assert_param(LineConfig);
+    assert_param(IS_EXTI_PORT(LineConfig->Port));
+    assert_param(IS_EXTI_LINE(LineConfig->Line));
+    assert_param(IS_EXTI_EDGE(LineConfig->Edge));
+
+    EXTI_Line_t Line = LineConfig->Line;
+    uint32_t LineMask = MASK_1BIT << Line;
+    uint32_t Shift = (Line % EXTICR_LINES_PER_REG) * EXTICR_BITS_PER_LINE;
+
+    /* Masking the line while it is reconfigured */
+    EXTI->IMR &= ~LineMask;
+
+    CallBacks[Line] = LineConfig->CallBack;
+
+    /* Connecting the port to the line */
+    SYSCFG->EXTICR[Line / EXTICR_LINES_PER_REG] = (SYSCFG->EXTICR[Line / EXTICR_LINES_PER_REG] & ~(MASK_4BITS << Shift)) |
+                                                  ((uint32_t)PortCodes[LineConfig->Port] << Shift);
+
+    /* Trigger edges */
+    EXTI->RTSR = (LineConfig->Edge & EXTI_EDGE_RISING) ? (EXTI->RTSR | LineMask) : (EXTI->RTSR & ~LineMask);
+    EXTI->FTSR = (LineConfig->Edge & EXTI_EDGE_FALLING) ? (EXTI->FTSR | LineMask) : (EXTI->FTSR & ~LineMask);
+
+    /* Dropping edges latched by a previous configuration */
+    EXTI->PR = LineMask;
+
+    EXTI->IMR |= LineMask;
+    NVIC_enableIRQ(getLineIRQ(Line));
+
+    return MCAL_OK;
+}
+
+MCAL_Status_t EXTI_disableLine(EXTI_Line_t Line)
+{
+    assert_param(IS_EXTI_LINE(Line));
+
+    /* The NVIC interrupt may be shared with other lines, it is left enabled */
+    EXTI->IMR &= ~(MASK_1BIT << Line);
+    return MCAL_OK;
+}
+
+MCAL_Status_t EXTI_enableLine(EXTI_Line_t Line)
+{
+    assert_param(IS_EXTI_LINE(Line));
+
+    /* Discarding an edge latched while the line was masked, a pending edge of an enabled line is kept */
+    if(!(EXTI->IMR & (MASK_1BIT << Line)))
+    {
+        EXTI->PR = (MASK_1BIT << Line);
+    }
+    EXTI->IMR |= (MASK_1BIT << Line);
+    return MCAL_OK;
+}
+
+MCAL_Status_t EXTI_clearPending(EXTI_Line_t Line)
+{
+    assert_param(IS_EXTI_LINE(Line));
+
+    EXTI->PR = (MASK_1BIT << Line);
+    return MCAL_OK;
+}
+
+void EXTI0_IRQHandler(void)
+{
+    HandleLines(MASK_1BIT << EXTI_LINE0);
+}
+
+void EXTI1_IRQHandler(void)
+{
+    HandleLines(MASK_1BIT << EXTI_LINE1);
+}
+
+void EXTI2_IRQHandler(void)
+{
+    HandleLines(MASK_1BIT << EXTI_LINE2);
+}
+
+void EXTI3_IRQHandler(void)
+{
+    HandleLines(MASK_1BIT << EXTI_LINE3);
+}
+
+void EXTI4_IRQHandler(void)
+{
+    HandleLines(MASK_1BIT << EXTI_LINE4);
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+    HandleLines(EXTI_LINES_9_5_MASK);
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+    HandleLines(EXTI_LINES_15_10_MASK);
+}
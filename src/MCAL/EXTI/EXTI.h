@@ -0,0 +1,123 @@
+/**
+ * @file EXTI.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Header file for the External Interrupt/event controller (GPIO lines)
+ * @version 0.1
+ * @date 2024-04-09
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef MCAL_EXTI_EXTI_H_
+#define MCAL_EXTI_EXTI_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "MCAL/stm32f401.h"
+#include "MCAL/GPIO/GPIO.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Callback executed from the interrupt handler when the edge is detected on its line.
+ */
+typedef void (*EXTI_CallBackFn_t)(void);
+
+/**
+ * @brief Enumeration for the EXTI lines connected to the GPIO pins, line n serves pin n of one port.
+ */
+typedef enum
+{
+    EXTI_LINE0,
+    EXTI_LINE1,
+    EXTI_LINE2,
+    EXTI_LINE3,
+    EXTI_LINE4,
+    EXTI_LINE5,
+    EXTI_LINE6,
+    EXTI_LINE7,
+    EXTI_LINE8,
+    EXTI_LINE9,
+    EXTI_LINE10,
+    EXTI_LINE11,
+    EXTI_LINE12,
+    EXTI_LINE13,
+    EXTI_LINE14,
+    EXTI_LINE15,
+    _EXTI_NUM_OF_LINES,     /**< Total number of GPIO lines ^^DO NOT MODIFY^^ */
+} EXTI_Line_t;
+
+/**
+ * @brief Enumeration for the edges triggering a line.
+ */
+typedef enum
+{
+    EXTI_EDGE_RISING  = 0x1UL,   /**< Rising edge */
+    EXTI_EDGE_FALLING = 0x2UL,   /**< Falling edge */
+    EXTI_EDGE_BOTH    = 0x3UL,   /**< Rising and falling edges */
+} EXTI_Edge_t;
+
+/**
+ * @brief Structure for the configuration of an EXTI line.
+ */
+typedef struct
+{
+    GPIO_Port_t       Port;        /**< Port of the pin driving the line, the pin number is the line number */
+    EXTI_Line_t       Line;        /**< EXTI line */
+    EXTI_Edge_t       Edge;        /**< Edges triggering the interrupt */
+    EXTI_CallBackFn_t CallBack;    /**< Function called on each trigger, may be NULL */
+} EXTI_LineConfig_t;
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Connects a GPIO pin to its EXTI line and enables the interrupt of the line.
+ * 
+ * Selects the port through SYSCFG_EXTICR, configures the trigger edges, clears any stale pending
+ * request, unmasks the line and enables its interrupt in the NVIC.
+ * 
+ * @param LineConfig Configuration of the line.
+ * @note The SYSCFG clock must be enabled and the pin configured as an input beforehand.
+ * @return Status indicating the success or failure of the initialization @ref MCAL_Status_t.
+ */
+MCAL_Status_t EXTI_initLine(EXTI_LineConfig_t const *LineConfig);
+
+/**
+ * @brief Masks the interrupt of a line, edges occurring while masked are ignored.
+ * 
+ * @param Line The EXTI line.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t EXTI_disableLine(EXTI_Line_t Line);
+
+/**
+ * @brief Unmasks the interrupt of a line, an edge latched while it was masked is discarded.
+ * 
+ * @param Line The EXTI line.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t EXTI_enableLine(EXTI_Line_t Line);
+
+/**
+ * @brief Clears the pending request of a line.
+ * 
+ * @param Line The EXTI line.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t EXTI_clearPending(EXTI_Line_t Line);
+
+
+#endif // MCAL_EXTI_EXTI_H_
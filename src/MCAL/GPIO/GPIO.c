@@ -12,7 +12,9 @@
 /********************************************************************************************************/
 /************************************************Includes************************************************/
 /********************************************************************************************************/
+#include <stddef.h>
 #include "MCAL/GPIO/GPIO.h"
+#include "MCAL/GPIO/GPIO_Reg.h"
 #include "assertparam.h"
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
@@ -24,18 +26,24 @@
 #define GPIO_PINMODE_GET_PULL(PinMode) ((PinMode & 0x0F0UL) >> 4)
 #define GPIO_PINMODE_GET_OUTPUT_TYPE(PinMode) ((PinMode & 0xF00UL) >> 8)
 
+#define NUM_OF_GPIOS (6)
+#define NUM_OF_PINS  (16)
 
-/************************************/
-/***************Registers************/
-/************************************/
-#define GPIOA_BASE (0x40020000UL)
-#define GPIOB_BASE (0x40020400UL)
-#define GPIOC_BASE (0x40020800UL)
-#define GPIOD_BASE (0x40020C00UL)
-#define GPIOE_BASE (0x40021000UL)
-#define GPIOH_BASE (0x40021C00UL)
+/* MODER field values of the input, alternate and analog modes */
+#define MODER_INPUT     (0x0UL)
+#define MODER_ALTERNATE (0x2UL)
+#define MODER_ANALOG    (0x3UL)
 
-#define NUM_OF_GPIOS (6)
+/* AFRL holds the 4-bit fields of pins 0 to 7, AFRH the ones of pins 8 to 15 */
+#define MASK_4BITS       (0xFUL)
+#define AFR_PINS_PER_REG (8)
+
+#define AF(NUM)     (1U << (NUM))
+/* EVENTOUT is available on every pin */
+#define AF_EVENTOUT AF(GPIO_AF15)
+
+/* BSRR: the lower half sets pins, the upper half resets them */
+#define BSRR_RESET_SHIFT (16)
 
 /************************************/
 /***************Validators************/
@@ -71,6 +79,14 @@
                               ((SPEED) == GPIO_SPEED_HIGH)      || \
                               ((SPEED) == GPIO_SPEED_VERY_HIGH))
 
+#define IS_GPIO_AF(ALTFN) (((ALTFN) >= GPIO_AF0) && ((ALTFN) <= GPIO_AF15))
+
+#define IS_GPIO_AF_AVAILABLE(PORT, PIN, ALTFN) ((AvailableAFs[(PORT)][(PIN)] | AF_EVENTOUT) & AF(ALTFN))
+
+#define IS_GPIO_PINGROUP_SIZE(NUM) (((NUM) > 0) && ((NUM) <= GPIO_PINGROUP_MAX_PINS))
+
+#define IS_GPIO_FIELD(FIRST, WIDTH) (IS_GPIO_PIN(FIRST) && ((WIDTH) > 0) && (((FIRST) + (WIDTH)) <= NUM_OF_PINS))
+
 #define IS_GPIO_PIN_STATE(STATE) (((STATE) == GPIO_PINSTATE_RESET) || \
                                   ((STATE) == GPIO_PINSTATE_SET))
 
@@ -78,27 +94,20 @@
 /************************************************Types***************************************************/
 /********************************************************************************************************/
 
-/***********************************************************/
-/******************Peripheral Register GPIO******************/
-/***********************************************************/
-
 /**
- * @brief Structure representing the GPIO peripheral registers.
- *
- * This structure encapsulates the various registers associated with a GPIO port.
+ * @brief Configuration register fields of a port, accumulated by GPIO_initPins().
  */
-typedef struct {
-    uint32_t MODER;     /**< GPIO port mode register. */
-    uint32_t OTYPER;    /**< GPIO port output type register. */
-    uint32_t OSPEEDR;   /**< GPIO port output speed register. */
-    uint32_t PUPDR;     /**< GPIO port pull-up/pull-down register. */
-    uint32_t IDR;       /**< GPIO port input data register. */
-    uint32_t ODR;       /**< GPIO port output data register. */
-    uint32_t BSRR;      /**< GPIO port bit set/reset register. */
-    uint32_t LCKR;      /**< GPIO port lock register. */
-    uint32_t AFRL;      /**< GPIO port alternate function low register. */
-    uint32_t AFRH;      /**< GPIO port alternate function high register. */
-} GPIO_TypeDef;
+typedef struct
+{
+    uint32_t Mask2Bits;     /**< Fields of the configured pins in the 2-bit registers */
+    uint32_t Mask1Bit;      /**< Bits of the configured pins in OTYPER */
+    uint32_t MODER;
+    uint32_t PUPDR;
+    uint32_t OTYPER;
+    uint32_t OSPEEDR;
+    uint32_t MaskAFR[2];    /**< Fields of the pins in alternate mode in AFRL and AFRH */
+    uint32_t AFR[2];
+} PortConfig_t;
 
 
 /********************************************************************************************************/
@@ -114,9 +123,94 @@ GPIO_TypeDef volatile *const GPIOS[NUM_OF_GPIOS] = {
     [GPIO_GPIOH]=(GPIO_TypeDef volatile *const)GPIOH_BASE,
 };
 
+/**
+ * @brief Alternate functions of each pin, from the alternate function mapping of the STM32F401 datasheet.
+ * 
+ * EVENTOUT (AF15) is available on every pin and is not listed.
+ */
+static const uint16_t AvailableAFs[NUM_OF_GPIOS][NUM_OF_PINS] = {
+    [GPIO_GPIOA] = {
+        [GPIO_PIN0]  = AF(GPIO_AF1) | AF(GPIO_AF2) | AF(GPIO_AF7),
+        [GPIO_PIN1]  = AF(GPIO_AF1) | AF(GPIO_AF2) | AF(GPIO_AF7),
+        [GPIO_PIN2]  = AF(GPIO_AF1) | AF(GPIO_AF2) | AF(GPIO_AF3) | AF(GPIO_AF7),
+        [GPIO_PIN3]  = AF(GPIO_AF1) | AF(GPIO_AF2) | AF(GPIO_AF3) | AF(GPIO_AF7),
+        [GPIO_PIN4]  = AF(GPIO_AF5) | AF(GPIO_AF6) | AF(GPIO_AF7),
+        [GPIO_PIN5]  = AF(GPIO_AF1) | AF(GPIO_AF5),
+        [GPIO_PIN6]  = AF(GPIO_AF1) | AF(GPIO_AF2) | AF(GPIO_AF5),
+        [GPIO_PIN7]  = AF(GPIO_AF1) | AF(GPIO_AF2) | AF(GPIO_AF5),
+        [GPIO_PIN8]  = AF(GPIO_AF0) | AF(GPIO_AF1) | AF(GPIO_AF4) | AF(GPIO_AF7) | AF(GPIO_AF10),
+        [GPIO_PIN9]  = AF(GPIO_AF1) | AF(GPIO_AF4) | AF(GPIO_AF7) | AF(GPIO_AF10),
+        [GPIO_PIN10] = AF(GPIO_AF1) | AF(GPIO_AF7) | AF(GPIO_AF10),
+        [GPIO_PIN11] = AF(GPIO_AF1) | AF(GPIO_AF7) | AF(GPIO_AF8) | AF(GPIO_AF10),
+        [GPIO_PIN12] = AF(GPIO_AF1) | AF(GPIO_AF7) | AF(GPIO_AF8) | AF(GPIO_AF10),
+        [GPIO_PIN13] = AF(GPIO_AF0),
+        [GPIO_PIN14] = AF(GPIO_AF0),
+        [GPIO_PIN15] = AF(GPIO_AF0) | AF(GPIO_AF1) | AF(GPIO_AF5) | AF(GPIO_AF6),
+    },
+    [GPIO_GPIOB] = {
+        [GPIO_PIN0]  = AF(GPIO_AF1) | AF(GPIO_AF2),
+        [GPIO_PIN1]  = AF(GPIO_AF1) | AF(GPIO_AF2),
+        [GPIO_PIN3]  = AF(GPIO_AF0) | AF(GPIO_AF1) | AF(GPIO_AF5) | AF(GPIO_AF6) | AF(GPIO_AF9),
+        [GPIO_PIN4]  = AF(GPIO_AF0) | AF(GPIO_AF2) | AF(GPIO_AF5) | AF(GPIO_AF6) | AF(GPIO_AF7) | AF(GPIO_AF9),
+        [GPIO_PIN5]  = AF(GPIO_AF2) | AF(GPIO_AF4) | AF(GPIO_AF5) | AF(GPIO_AF6),
+        [GPIO_PIN6]  = AF(GPIO_AF2) | AF(GPIO_AF4) | AF(GPIO_AF7),
+        [GPIO_PIN7]  = AF(GPIO_AF2) | AF(GPIO_AF4) | AF(GPIO_AF7),
+        [GPIO_PIN8]  = AF(GPIO_AF2) | AF(GPIO_AF3) | AF(GPIO_AF4) | AF(GPIO_AF12),
+        [GPIO_PIN9]  = AF(GPIO_AF2) | AF(GPIO_AF3) | AF(GPIO_AF4) | AF(GPIO_AF5) | AF(GPIO_AF12),
+        [GPIO_PIN10] = AF(GPIO_AF1) | AF(GPIO_AF4) | AF(GPIO_AF5),
+        [GPIO_PIN11] = AF(GPIO_AF1) | AF(GPIO_AF4),
+        [GPIO_PIN12] = AF(GPIO_AF1) | AF(GPIO_AF4) | AF(GPIO_AF5),
+        [GPIO_PIN13] = AF(GPIO_AF1) | AF(GPIO_AF5),
+        [GPIO_PIN14] = AF(GPIO_AF1) | AF(GPIO_AF5) | AF(GPIO_AF6),
+        [GPIO_PIN15] = AF(GPIO_AF0) | AF(GPIO_AF1) | AF(GPIO_AF5),
+    },
+    [GPIO_GPIOC] = {
+        [GPIO_PIN2]  = AF(GPIO_AF5) | AF(GPIO_AF6),
+        [GPIO_PIN3]  = AF(GPIO_AF5),
+        [GPIO_PIN6]  = AF(GPIO_AF2) | AF(GPIO_AF5) | AF(GPIO_AF8) | AF(GPIO_AF12),
+        [GPIO_PIN7]  = AF(GPIO_AF2) | AF(GPIO_AF6) | AF(GPIO_AF8) | AF(GPIO_AF12),
+        [GPIO_PIN8]  = AF(GPIO_AF2) | AF(GPIO_AF8) | AF(GPIO_AF12),
+        [GPIO_PIN9]  = AF(GPIO_AF0) | AF(GPIO_AF2) | AF(GPIO_AF4) | AF(GPIO_AF5) | AF(GPIO_AF12),
+        [GPIO_PIN10] = AF(GPIO_AF6) | AF(GPIO_AF12),
+        [GPIO_PIN11] = AF(GPIO_AF5) | AF(GPIO_AF6) | AF(GPIO_AF12),
+        [GPIO_PIN12] = AF(GPIO_AF6) | AF(GPIO_AF12),
+    },
+    [GPIO_GPIOD] = {
+        [GPIO_PIN2]  = AF(GPIO_AF2) | AF(GPIO_AF12),
+        [GPIO_PIN3]  = AF(GPIO_AF5) | AF(GPIO_AF7),
+        [GPIO_PIN4]  = AF(GPIO_AF7),
+        [GPIO_PIN5]  = AF(GPIO_AF7),
+        [GPIO_PIN6]  = AF(GPIO_AF5) | AF(GPIO_AF7),
+        [GPIO_PIN7]  = AF(GPIO_AF7),
+        [GPIO_PIN12] = AF(GPIO_AF2),
+        [GPIO_PIN13] = AF(GPIO_AF2),
+        [GPIO_PIN14] = AF(GPIO_AF2),
+        [GPIO_PIN15] = AF(GPIO_AF2),
+    },
+    [GPIO_GPIOE] = {
+        [GPIO_PIN0]  = AF(GPIO_AF2),
+        [GPIO_PIN2]  = AF(GPIO_AF0) | AF(GPIO_AF5),
+        [GPIO_PIN3]  = AF(GPIO_AF0),
+        [GPIO_PIN4]  = AF(GPIO_AF0) | AF(GPIO_AF5),
+        [GPIO_PIN5]  = AF(GPIO_AF0) | AF(GPIO_AF3) | AF(GPIO_AF5),
+        [GPIO_PIN6]  = AF(GPIO_AF0) | AF(GPIO_AF3) | AF(GPIO_AF5),
+        [GPIO_PIN7]  = AF(GPIO_AF1),
+        [GPIO_PIN8]  = AF(GPIO_AF1),
+        [GPIO_PIN9]  = AF(GPIO_AF1),
+        [GPIO_PIN10] = AF(GPIO_AF1),
+        [GPIO_PIN11] = AF(GPIO_AF1) | AF(GPIO_AF5),
+        [GPIO_PIN12] = AF(GPIO_AF1) | AF(GPIO_AF5),
+        [GPIO_PIN13] = AF(GPIO_AF1) | AF(GPIO_AF5),
+        [GPIO_PIN14] = AF(GPIO_AF1) | AF(GPIO_AF5),
+        [GPIO_PIN15] = AF(GPIO_AF1),
+    },
+    /* PH0 and PH1 are the HSE oscillator pins, only EVENTOUT */
+};
+
 /********************************************************************************************************/
 /*****************************************Static Functions Prototype*************************************/
 /********************************************************************************************************/
+static MCAL_Status_t InitPinGroup(GPIO_PinGroup_t *Group, GPIO_PinID_t const *Pins, uint32_t NumOfPins, uint32_t *Lut);
 
 /********************************************************************************************************/
 /*********************************************APIs Implementation****************************************/
@@ -137,6 +231,24 @@ MCAL_Status_t GPIO_initPin(GPIO_PinConfig_t const *PinConfig)
     uint32_t PinPull = GPIO_PINMODE_GET_PULL(PinConfig->PinMode);
     uint32_t PinOutputType = GPIO_PINMODE_GET_OUTPUT_TYPE(PinConfig->PinMode);
 
+    /* Set Pin Alternate Function, before the mode so that the pin never drives another function */
+    if(PinMode == MODER_ALTERNATE)
+    {
+        uint32_t volatile *const AFR = (PinConfig->PinNumber < AFR_PINS_PER_REG) ? &GPIO->AFRL : &GPIO->AFRH;
+        uint32_t ShiftAFR = (PinConfig->PinNumber % AFR_PINS_PER_REG) * 4;
+
+        assert_param(IS_GPIO_AF(PinConfig->AlternateFunction));
+        assert_param(IS_GPIO_AF_AVAILABLE(PinConfig->Port, PinConfig->PinNumber, PinConfig->AlternateFunction));
+
+        if(!IS_GPIO_AF(PinConfig->AlternateFunction) ||
+           !IS_GPIO_AF_AVAILABLE(PinConfig->Port, PinConfig->PinNumber, PinConfig->AlternateFunction))
+        {
+            return MCAL_ERROR;
+        }
+
+        *AFR = (*AFR & ~(MASK_4BITS << ShiftAFR)) | ((uint32_t)PinConfig->AlternateFunction << ShiftAFR);
+    }
+
 
     /* Set Pin Mode */
     GPIO->MODER = (GPIO->MODER & ~(MASK_2BITS << (PinConfig->PinNumber * 2))) | (PinMode << (PinConfig->PinNumber * 2));
@@ -151,6 +263,91 @@ MCAL_Status_t GPIO_initPin(GPIO_PinConfig_t const *PinConfig)
     return MCAL_OK;
 }
 
+MCAL_Status_t GPIO_initPins(GPIO_PinConfig_t const *PinConfigs, uint32_t NumOfPins)
+{
+    PortConfig_t PortConfigs[NUM_OF_GPIOS] = {0};
+    uint32_t Port;
+    uint32_t idx;
+
+    assert_param(PinConfigs);
+
+    /* Rejecting the whole table before touching any register */
+    for(idx = 0; idx < NumOfPins; idx++)
+    {
+        GPIO_PinConfig_t const *PinConfig = &PinConfigs[idx];
+
+        /* The port and the pin index the tables below */
+        if(!IS_GPIO_PORT(PinConfig->Port) || !IS_GPIO_PIN(PinConfig->PinNumber))
+        {
+            assert_param(0);
+            return MCAL_ERROR;
+        }
+
+        if((GPIO_PINMODE_GET_MODE(PinConfig->PinMode) == MODER_ALTERNATE) &&
+           (!IS_GPIO_AF(PinConfig->AlternateFunction) ||
+            !IS_GPIO_AF_AVAILABLE(PinConfig->Port, PinConfig->PinNumber, PinConfig->AlternateFunction)))
+        {
+            assert_param(0);
+            return MCAL_ERROR;
+        }
+    }
+
+    /* Merging the configurations of each port, a later configuration of a pin overrides the earlier ones */
+    for(idx = 0; idx < NumOfPins; idx++)
+    {
+        GPIO_PinConfig_t const *PinConfig = &PinConfigs[idx];
+        PortConfig_t *PortConfig = &PortConfigs[PinConfig->Port];
+        uint32_t Shift2Bits = PinConfig->PinNumber * 2;
+
+        assert_param(IS_GPIO_SPEED(PinConfig->PinSpeed));
+        assert_param(IS_GPIO_MODE(PinConfig->PinMode));
+
+        PortConfig->Mask2Bits |= MASK_2BITS << Shift2Bits;
+        PortConfig->Mask1Bit |= MASK_1BIT << PinConfig->PinNumber;
+
+        PortConfig->MODER = (PortConfig->MODER & ~(MASK_2BITS << Shift2Bits)) | (GPIO_PINMODE_GET_MODE(PinConfig->PinMode) << Shift2Bits);
+        PortConfig->PUPDR = (PortConfig->PUPDR & ~(MASK_2BITS << Shift2Bits)) | (GPIO_PINMODE_GET_PULL(PinConfig->PinMode) << Shift2Bits);
+        PortConfig->OTYPER = (PortConfig->OTYPER & ~(MASK_1BIT << PinConfig->PinNumber)) | (GPIO_PINMODE_GET_OUTPUT_TYPE(PinConfig->PinMode) << PinConfig->PinNumber);
+        PortConfig->OSPEEDR = (PortConfig->OSPEEDR & ~(MASK_2BITS << Shift2Bits)) | ((uint32_t)PinConfig->PinSpeed << Shift2Bits);
+
+        if(GPIO_PINMODE_GET_MODE(PinConfig->PinMode) == MODER_ALTERNATE)
+        {
+            uint32_t AFRIdx = PinConfig->PinNumber / AFR_PINS_PER_REG;
+            uint32_t ShiftAFR = (PinConfig->PinNumber % AFR_PINS_PER_REG) * 4;
+
+            PortConfig->MaskAFR[AFRIdx] |= MASK_4BITS << ShiftAFR;
+            PortConfig->AFR[AFRIdx] = (PortConfig->AFR[AFRIdx] & ~(MASK_4BITS << ShiftAFR)) | ((uint32_t)PinConfig->AlternateFunction << ShiftAFR);
+        }
+    }
+
+    /* One read-modify-write per register of each port involved */
+    for(Port = 0; Port < NUM_OF_GPIOS; Port++)
+    {
+        PortConfig_t const *PortConfig = &PortConfigs[Port];
+        GPIO_TypeDef volatile *const GPIO = GPIOS[Port];
+
+        if(PortConfig->Mask1Bit == 0)
+        {
+            continue;
+        }
+
+        if(PortConfig->MaskAFR[0])
+        {
+            GPIO->AFRL = (GPIO->AFRL & ~PortConfig->MaskAFR[0]) | PortConfig->AFR[0];
+        }
+        if(PortConfig->MaskAFR[1])
+        {
+            GPIO->AFRH = (GPIO->AFRH & ~PortConfig->MaskAFR[1]) | PortConfig->AFR[1];
+        }
+        GPIO->MODER = (GPIO->MODER & ~PortConfig->Mask2Bits) | PortConfig->MODER;
+        GPIO->PUPDR = (GPIO->PUPDR & ~PortConfig->Mask2Bits) | PortConfig->PUPDR;
+        GPIO->OTYPER = (GPIO->OTYPER & ~PortConfig->Mask1Bit) | PortConfig->OTYPER;
+        GPIO->OSPEEDR = (GPIO->OSPEEDR & ~PortConfig->Mask2Bits) | PortConfig->OSPEEDR;
+    }
+
+    return MCAL_OK;
+}
+
 MCAL_Status_t GPIO_setPinValue(GPIO_Port_t Port, GPIO_Pin_t PinNumber, GPIO_PinState_t PinState)
 {
     assert_param(IS_GPIO_PORT(Port));
@@ -158,7 +355,261 @@ MCAL_Status_t GPIO_setPinValue(GPIO_Port_t Port, GPIO_Pin_t PinNumber, GPIO_PinS
     assert_param(IS_GPIO_PIN_STATE(PinState));
 
     GPIO_TypeDef volatile *const GPIO = GPIOS[Port];
-    GPIO->ODR = (GPIO->ODR & ~(MASK_1BIT << PinNumber)) | (PinState << PinNumber);
+    GPIO->BSRR = (MASK_1BIT << PinNumber) << ((PinState == GPIO_PINSTATE_SET) ? 0 : BSRR_RESET_SHIFT);
+    return MCAL_OK;
+}
+
+MCAL_Status_t GPIO_setResetPins(GPIO_Port_t Port, uint16_t SetPins, uint16_t ResetPins)
+{
+    assert_param(IS_GPIO_PORT(Port));
+
+    GPIO_TypeDef volatile *const GPIO = GPIOS[Port];
+    GPIO->BSRR = (uint32_t)SetPins | ((uint32_t)ResetPins << BSRR_RESET_SHIFT);
+    return MCAL_OK;
+}
+
+uint32_t GPIO_getSetResetRegAddress(GPIO_Port_t Port)
+{
+    assert_param(IS_GPIO_PORT(Port));
+
+    return (uint32_t)(uintptr_t)&GPIOS[Port]->BSRR;
+}
+
+MCAL_Status_t GPIO_writePortField(GPIO_Port_t Port, GPIO_Pin_t FirstPin, uint32_t Width, uint16_t Value)
+{
+    assert_param(IS_GPIO_PORT(Port));
+    assert_param(IS_GPIO_FIELD(FirstPin, Width));
+
+    uint32_t Mask = (MASK_1BIT << Width) - 1;
+
+    /* The zero bits of the field reset their pins in the same store */
+    GPIOS[Port]->BSRR = ((Value & Mask) << FirstPin) | ((~(uint32_t)Value & Mask) << (FirstPin + BSRR_RESET_SHIFT));
+    return MCAL_OK;
+}
+
+uint16_t GPIO_readPortField(GPIO_Port_t Port, GPIO_Pin_t FirstPin, uint32_t Width)
+{
+    assert_param(IS_GPIO_PORT(Port));
+    assert_param(IS_GPIO_FIELD(FirstPin, Width));
+
+    return (uint16_t)((GPIOS[Port]->IDR >> FirstPin) & ((MASK_1BIT << Width) - 1));
+}
+
+MCAL_Status_t GPIO_initPinGroup(GPIO_PinGroup_t *Group, GPIO_PinID_t const *Pins, uint32_t NumOfPins)
+{
+    return InitPinGroup(Group, Pins, NumOfPins, NULL);
+}
+
+MCAL_Status_t GPIO_initPinGroupLut(GPIO_PinGroup_t *Group, GPIO_PinID_t const *Pins, uint32_t NumOfPins, uint32_t *Lut)
+{
+    assert_param(Lut);
+
+    return InitPinGroup(Group, Pins, NumOfPins, Lut);
+}
+
+/**
+ * @brief Builds a pin group, scattered pins of one port use the lookup table @p Lut if it is not NULL.
+ */
+static MCAL_Status_t InitPinGroup(GPIO_PinGroup_t *Group, GPIO_PinID_t const *Pins, uint32_t NumOfPins, uint32_t *Lut)
+{
+    uint32_t PortPinsMask[NUM_OF_GPIOS] = {0};
+    uint32_t Port;
+    uint32_t idx;
+
+    assert_param(Group);
+    assert_param(Pins);
+    assert_param(IS_GPIO_PINGROUP_SIZE(NumOfPins));
+
+    if(!IS_GPIO_PINGROUP_SIZE(NumOfPins))
+    {
+        return MCAL_ERROR;
+    }
+
+    for(idx = 0; idx < NumOfPins; idx++)
+    {
+        assert_param(IS_GPIO_PORT(Pins[idx].Port));
+        assert_param(IS_GPIO_PIN(Pins[idx].PinNumber));
+
+        if(PortPinsMask[Pins[idx].Port] & (MASK_1BIT << Pins[idx].PinNumber))
+        {
+            return MCAL_ERROR;
+        }
+        PortPinsMask[Pins[idx].Port] |= MASK_1BIT << Pins[idx].PinNumber;
+    }
+
+    /* Grouping the pins by port, keeping track of the value bit driving each of them */
+    Group->NumOfPorts = 0;
+    NumOfPins = 0;
+    for(Port = 0; Port < NUM_OF_GPIOS; Port++)
+    {
+        GPIO_PinGroupPort_t *GroupPort = &Group->Ports[Group->NumOfPorts];
+
+        if(PortPinsMask[Port] == 0)
+        {
+            continue;
+        }
+
+        GroupPort->Port = (uint8_t)Port;
+        GroupPort->FirstPin = (uint8_t)NumOfPins;
+        GroupPort->PinsMask = (uint16_t)PortPinsMask[Port];
+        for(idx = 0; PortPinsMask[Port]; idx++)
+        {
+            if((uint32_t)Pins[idx].Port == Port)
+            {
+                Group->ValueBit[NumOfPins] = (uint8_t)idx;
+                Group->PinMask[NumOfPins] = (uint16_t)(MASK_1BIT << Pins[idx].PinNumber);
+                PortPinsMask[Port] &= ~(MASK_1BIT << Pins[idx].PinNumber);
+                NumOfPins++;
+            }
+        }
+        GroupPort->NumOfPins = (uint8_t)(NumOfPins - GroupPort->FirstPin);
+        Group->NumOfPorts++;
+    }
+
+    /* Choosing the fastest access the pins allow */
+    Group->Access = GPIO_PINGROUP_ACCESS_PINS;
+    Group->Lut = NULL;
+    Group->ValueMask = (uint16_t)((MASK_1BIT << NumOfPins) - 1);
+    if(Group->NumOfPorts == 1)
+    {
+        uint32_t Value;
+
+        Group->Access = GPIO_PINGROUP_ACCESS_FIELD;
+        Group->FieldShift = (uint8_t)Pins[0].PinNumber;
+        for(idx = 1; idx < NumOfPins; idx++)
+        {
+            if(Pins[idx].PinNumber != (Pins[0].PinNumber + idx))
+            {
+                Group->Access = GPIO_PINGROUP_ACCESS_PINS;
+                break;
+            }
+        }
+
+        if((Group->Access == GPIO_PINGROUP_ACCESS_PINS) && (Lut != NULL) && (NumOfPins <= GPIO_PINGROUP_LUT_MAX_PINS))
+        {
+            Group->Access = GPIO_PINGROUP_ACCESS_LUT;
+            Group->Lut = Lut;
+            for(Value = 0; Value <= Group->ValueMask; Value++)
+            {
+                uint32_t SetMask = 0;
+
+                for(idx = 0; idx < NumOfPins; idx++)
+                {
+                    if((Value >> idx) & MASK_1BIT)
+                    {
+                        SetMask |= MASK_1BIT << Pins[idx].PinNumber;
+                    }
+                }
+                Group->Lut[Value] = SetMask | ((Group->Ports[0].PinsMask & ~SetMask) << BSRR_RESET_SHIFT);
+            }
+        }
+    }
+
+    return MCAL_OK;
+}
+
+MCAL_Status_t GPIO_writePinGroup(GPIO_PinGroup_t const *Group, uint32_t Value)
+{
+    uint32_t PortIdx;
+    uint32_t idx;
+
+    assert_param(Group);
+
+    if(Group->Access == GPIO_PINGROUP_ACCESS_FIELD)
+    {
+        Value &= Group->ValueMask;
+        GPIOS[Group->Ports[0].Port]->BSRR = (Value << Group->FieldShift) |
+                                            ((~Value & Group->ValueMask) << (Group->FieldShift + BSRR_RESET_SHIFT));
+        return MCAL_OK;
+    }
+    if(Group->Access == GPIO_PINGROUP_ACCESS_LUT)
+    {
+        GPIOS[Group->Ports[0].Port]->BSRR = Group->Lut[Value & Group->ValueMask];
+        return MCAL_OK;
+    }
+
+    for(PortIdx = 0; PortIdx < Group->NumOfPorts; PortIdx++)
+    {
+        GPIO_PinGroupPort_t const *GroupPort = &Group->Ports[PortIdx];
+        uint32_t SetMask = 0;
+
+        for(idx = GroupPort->FirstPin; idx < (uint32_t)(GroupPort->FirstPin + GroupPort->NumOfPins); idx++)
+        {
+            if((Value >> Group->ValueBit[idx]) & MASK_1BIT)
+            {
+                SetMask |= Group->PinMask[idx];
+            }
+        }
+
+        /* Pins of the group not set are reset by the same store */
+        GPIOS[GroupPort->Port]->BSRR = SetMask | ((GroupPort->PinsMask & ~SetMask) << BSRR_RESET_SHIFT);
+    }
+
+    return MCAL_OK;
+}
+
+uint32_t GPIO_readPinGroup(GPIO_PinGroup_t const *Group)
+{
+    uint32_t Value = 0;
+    uint32_t PortIdx;
+    uint32_t idx;
+
+    assert_param(Group);
+
+    if(Group->Access == GPIO_PINGROUP_ACCESS_FIELD)
+    {
+        return (GPIOS[Group->Ports[0].Port]->IDR >> Group->FieldShift) & Group->ValueMask;
+    }
+
+    for(PortIdx = 0; PortIdx < Group->NumOfPorts; PortIdx++)
+    {
+        GPIO_PinGroupPort_t const *GroupPort = &Group->Ports[PortIdx];
+        uint32_t Levels = GPIOS[GroupPort->Port]->IDR;
+
+        for(idx = GroupPort->FirstPin; idx < (uint32_t)(GroupPort->FirstPin + GroupPort->NumOfPins); idx++)
+        {
+            if(Levels & Group->PinMask[idx])
+            {
+                Value |= MASK_1BIT << Group->ValueBit[idx];
+            }
+        }
+    }
+
+    return Value;
+}
+
+MCAL_Status_t GPIO_setPinGroupMode(GPIO_PinGroup_t const *Group, GPIO_PinMode_t PinMode)
+{
+    uint32_t PortIdx;
+
+    assert_param(Group);
+    assert_param(IS_GPIO_MODE(PinMode));
+
+    /* The group does not hold alternate functions */
+    if(GPIO_PINMODE_GET_MODE(PinMode) == MODER_ALTERNATE)
+    {
+        assert_param(0);
+        return MCAL_ERROR;
+    }
+
+    for(PortIdx = 0; PortIdx < Group->NumOfPorts; PortIdx++)
+    {
+        GPIO_PinGroupPort_t const *GroupPort = &Group->Ports[PortIdx];
+        GPIO_TypeDef volatile *const GPIO = GPIOS[GroupPort->Port];
+        uint32_t Mask1Bit = GroupPort->PinsMask;
+        uint32_t Mask2Bits;
+
+        /* Spreading the pin mask to the 2-bit fields: bit n moves to bit 2n */
+        Mask2Bits = (Mask1Bit | (Mask1Bit << 8)) & 0x00FF00FFUL;
+        Mask2Bits = (Mask2Bits | (Mask2Bits << 4)) & 0x0F0F0F0FUL;
+        Mask2Bits = (Mask2Bits | (Mask2Bits << 2)) & 0x33333333UL;
+        Mask2Bits = (Mask2Bits | (Mask2Bits << 1)) & 0x55555555UL;
+
+        GPIO->MODER = (GPIO->MODER & ~(Mask2Bits * MASK_2BITS)) | (Mask2Bits * GPIO_PINMODE_GET_MODE(PinMode));
+        GPIO->PUPDR = (GPIO->PUPDR & ~(Mask2Bits * MASK_2BITS)) | (Mask2Bits * GPIO_PINMODE_GET_PULL(PinMode));
+        GPIO->OTYPER = (GPIO->OTYPER & ~Mask1Bit) | (Mask1Bit * GPIO_PINMODE_GET_OUTPUT_TYPE(PinMode));
+    }
+
     return MCAL_OK;
 }
 
@@ -174,3 +625,32 @@ GPIO_PinState_t GPIO_getPinValue(GPIO_Port_t Port, GPIO_Pin_t PinNumber)
 
     return PinValue;
 }
+
+uint16_t GPIO_getPortValue(GPIO_Port_t Port)
+{
+    assert_param(IS_GPIO_PORT(Port));
+
+    GPIO_TypeDef volatile *const GPIO = GPIOS[Port];
+
+    return (uint16_t)GPIO->IDR;
+}
+
+GPIO_PinMode_t GPIO_getPinMode(GPIO_Port_t Port, GPIO_Pin_t PinNumber)
+{
+    assert_param(IS_GPIO_PORT(Port));
+    assert_param(IS_GPIO_PIN(PinNumber));
+
+    GPIO_TypeDef volatile *const GPIO = GPIOS[Port];
+
+    uint32_t PinMode = (GPIO->MODER >> (PinNumber * 2)) & MASK_2BITS;
+    uint32_t PinPull = (GPIO->PUPDR >> (PinNumber * 2)) & MASK_2BITS;
+    uint32_t PinOutputType = (GPIO->OTYPER >> PinNumber) & MASK_1BIT;
+
+    /* OTYPER has no effect on the input and analog pins */
+    if((PinMode == MODER_INPUT) || (PinMode == MODER_ANALOG))
+    {
+        PinOutputType = 0;
+    }
+
+    return (GPIO_PinMode_t)(PinMode | (PinPull << 4) | (PinOutputType << 8));
+}
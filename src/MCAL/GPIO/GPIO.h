@@ -20,6 +20,27 @@
 /************************************************Defines*************************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief Maximum number of pins in a pin group, bit i of the group value drives its i-th pin.
+ */
+#define GPIO_PINGROUP_MAX_PINS  16UL
+
+/**
+ * @brief Maximum number of ports a pin group can span.
+ */
+#define GPIO_PINGROUP_MAX_PORTS 6UL
+
+/**
+ * @brief Maximum number of scattered pins of one port written through a lookup table.
+ */
+#define GPIO_PINGROUP_LUT_MAX_PINS 8UL
+
+/**
+ * @brief Number of entries of the lookup table of a pin group of NumOfPins pins, one per value of its pins.
+ *
+ * Size of the storage passed to GPIO_initPinGroupLut().
+ */
+#define GPIO_PINGROUP_LUT_SIZE(NumOfPins) (1UL << (NumOfPins))
 
 /********************************************************************************************************/
 /************************************************Types***************************************************/
@@ -125,6 +146,33 @@ typedef enum
 } GPIO_PinSpeed_t;
 
 
+/**
+ * @brief Enumeration defining the alternate functions of the STM32F401 pins.
+ *
+ * The function behind each number depends on the pin, see the alternate function mapping of the
+ * datasheet. GPIO_initPin() rejects a function that the pin does not have.
+ */
+typedef enum
+{
+    GPIO_AF0,   /**< System: MCO, SWD/JTAG, trace, RTC_REFIN. */
+    GPIO_AF1,   /**< TIM1, TIM2. */
+    GPIO_AF2,   /**< TIM3, TIM4, TIM5. */
+    GPIO_AF3,   /**< TIM9, TIM10, TIM11. */
+    GPIO_AF4,   /**< I2C1, I2C2, I2C3. */
+    GPIO_AF5,   /**< SPI1, SPI2/I2S2, SPI4, I2S3ext. */
+    GPIO_AF6,   /**< SPI3/I2S3, I2S2ext. */
+    GPIO_AF7,   /**< USART1, USART2, I2S3ext. */
+    GPIO_AF8,   /**< USART6. */
+    GPIO_AF9,   /**< I2C2, I2C3 (SDA on PB3 and PB4). */
+    GPIO_AF10,  /**< OTG_FS. */
+    GPIO_AF11,  /**< Not used on the F401. */
+    GPIO_AF12,  /**< SDIO. */
+    GPIO_AF13,  /**< Not used on the F401. */
+    GPIO_AF14,  /**< Not used on the F401. */
+    GPIO_AF15   /**< EVENTOUT. */
+} GPIO_AF_t;
+
+
 /**
  * @brief Enumeration defining GPIO pin states.
  *
@@ -138,6 +186,16 @@ typedef enum
     GPIO_PINSTATE_SET    /**< Logic high state or activation. */
 } GPIO_PinState_t;
 
+/**
+ * @brief Enumeration defining how the pins of a group are accessed, chosen by GPIO_initPinGroup().
+ */
+typedef enum
+{
+    GPIO_PINGROUP_ACCESS_PINS,  /**< Pins spread over several ports or scattered, handled one by one. */
+    GPIO_PINGROUP_ACCESS_FIELD, /**< Contiguous pins of one port in increasing order, a shifted and masked value. */
+    GPIO_PINGROUP_ACCESS_LUT    /**< Scattered pins of one port, up to GPIO_PINGROUP_LUT_MAX_PINS, a table lookup (GPIO_initPinGroupLut()). */
+} GPIO_PinGroupAccess_t;
+
 
 
 /***************************************************/
@@ -157,8 +215,46 @@ typedef struct
     GPIO_Pin_t        PinNumber;   /**< Specific GPIO pin number. */
     GPIO_PinMode_t    PinMode;     /**< Configuration for pin mode. */
     GPIO_PinSpeed_t   PinSpeed;    /**< Speed setting for the GPIO pin. */
+    GPIO_AF_t         AlternateFunction; /**< Function connected to the pin, only used by the GPIO_MODE_ALTERNATE_* modes. */
 } GPIO_PinConfig_t;
 
+/**
+ * @brief Structure identifying a GPIO pin.
+ */
+typedef struct
+{
+    GPIO_Port_t       Port;        /**< GPIO port to which the pin belongs. */
+    GPIO_Pin_t        PinNumber;   /**< Specific GPIO pin number. */
+} GPIO_PinID_t;
+
+/**
+ * @brief Pins of a group located on the same port.
+ */
+typedef struct
+{
+    uint8_t           Port;        /**< GPIO port, @ref GPIO_Port_t. */
+    uint8_t           FirstPin;    /**< Index of its first pin in the ValueBit/PinMask arrays of the group. */
+    uint8_t           NumOfPins;   /**< Number of pins of the group on this port. */
+    uint16_t          PinsMask;    /**< Mask of the pins of the group on this port. */
+} GPIO_PinGroupPort_t;
+
+/**
+ * @brief Set of pins written together, filled by GPIO_initPinGroup().
+ *
+ * The pins are sorted by port so that a write costs one BSRR store per port involved.
+ */
+typedef struct
+{
+    uint32_t            NumOfPorts;                         /**< Number of ports spanned by the group. */
+    GPIO_PinGroupPort_t Ports[GPIO_PINGROUP_MAX_PORTS];     /**< Ports spanned by the group. */
+    uint8_t             ValueBit[GPIO_PINGROUP_MAX_PINS];   /**< Bit of the group value driving each pin. */
+    uint16_t            PinMask[GPIO_PINGROUP_MAX_PINS];    /**< Mask of each pin within its port. */
+    GPIO_PinGroupAccess_t Access;                           /**< Access method of the pins. */
+    uint8_t             FieldShift;                         /**< Number of the first pin, field access. */
+    uint16_t            ValueMask;                          /**< Bits of the group value driving a pin. */
+    uint32_t           *Lut;                                /**< BSRR word of each value, lookup table access, caller storage. */
+} GPIO_PinGroup_t;
+
 
 /********************************************************************************************************/
 /************************************************APIs****************************************************/
@@ -168,16 +264,33 @@ typedef struct
  * @brief Initializes a GPIO pin based on the provided configuration.
  *
  * This function configures a GPIO pin based on the parameters specified in the provided `GPIO_PinConfig_t`.
+ * In the alternate modes the pin is connected to `AlternateFunction`, which must be one the pin has on
+ * the STM32F401, otherwise the pin is left untouched and MCAL_ERROR is returned.
  *
  * @param[in] PinConfig Configuration structure for the GPIO pin.
  * @return Status indicating the success or failure of the initialization @ref MCAL_Status_t.
  */
 MCAL_Status_t GPIO_initPin(GPIO_PinConfig_t const *PinConfig);
 
+/**
+ * @brief Initializes several GPIO pins at once.
+ *
+ * The configurations are merged per port, so each configuration register of a port is read and
+ * written once whatever the number of its pins. When a pin is listed more than once, its last
+ * configuration applies.
+ *
+ * @param[in] PinConfigs Configuration structures of the GPIO pins.
+ * @param[in] NumOfPins Number of configuration structures.
+ * @return MCAL_ERROR, with no register written, if a pin does not exist or lacks its alternate function,
+ *         MCAL_OK otherwise @ref MCAL_Status_t.
+ */
+MCAL_Status_t GPIO_initPins(GPIO_PinConfig_t const *PinConfigs, uint32_t NumOfPins);
+
 /**
  * @brief Sets the value of a GPIO pin.
  *
  * This function sets the specified GPIO pin to the given state (High or Low).
+ * The pin is written through BSRR, so the update is atomic with respect to the other pins of the port.
  *
  * @param[in] Port The GPIO port to which the pin belongs.
  * @param[in] PinNumber The specific GPIO pin number.
@@ -186,6 +299,116 @@ MCAL_Status_t GPIO_initPin(GPIO_PinConfig_t const *PinConfig);
  */
 MCAL_Status_t GPIO_setPinValue(GPIO_Port_t Port, GPIO_Pin_t PinNumber, GPIO_PinState_t PinState);
 
+/**
+ * @brief Drives several pins of a port high and others low with a single BSRR store.
+ *
+ * The pins change state at the same time, the other pins of the port are not affected.
+ *
+ * @param[in] Port The GPIO port.
+ * @param[in] SetPins Pins to drive high, bit n is pin n.
+ * @param[in] ResetPins Pins to drive low, a pin listed in both masks is driven high.
+ * @return Status indicating the success or failure of the write @ref MCAL_Status_t.
+ */
+MCAL_Status_t GPIO_setResetPins(GPIO_Port_t Port, uint16_t SetPins, uint16_t ResetPins);
+
+/**
+ * @brief Gets the address of the BSRR register of a port.
+ *
+ * Destination of the DMA transfers driving the pins, each word written has the layout of the
+ * GPIO_setResetPins() masks: the set pins in the low half, the reset pins in the high half.
+ *
+ * @param[in] Port The GPIO port.
+ * @return The bus address of the register.
+ */
+uint32_t GPIO_getSetResetRegAddress(GPIO_Port_t Port);
+
+/**
+ * @brief Writes a contiguous field of pins of a port with a single BSRR store.
+ *
+ * Pin FirstPin + i takes the state of bit i of Value, the pins outside the field are not affected.
+ *
+ * @param[in] Port The GPIO port.
+ * @param[in] FirstPin The lowest pin of the field.
+ * @param[in] Width Number of pins of the field, FirstPin + Width must not exceed 16.
+ * @param[in] Value Value of the field.
+ * @return Status indicating the success or failure of the write @ref MCAL_Status_t.
+ */
+MCAL_Status_t GPIO_writePortField(GPIO_Port_t Port, GPIO_Pin_t FirstPin, uint32_t Width, uint16_t Value);
+
+/**
+ * @brief Reads a contiguous field of pins of a port with a single IDR load.
+ *
+ * @param[in] Port The GPIO port.
+ * @param[in] FirstPin The lowest pin of the field.
+ * @param[in] Width Number of pins of the field, FirstPin + Width must not exceed 16.
+ * @return The levels of the pins, bit i is the state of pin FirstPin + i.
+ */
+uint16_t GPIO_readPortField(GPIO_Port_t Port, GPIO_Pin_t FirstPin, uint32_t Width);
+
+/**
+ * @brief Builds a pin group from a list of pins.
+ *
+ * Pins[i] is driven by bit i of the values passed to GPIO_writePinGroup(), the pins may be spread
+ * over several ports in any order.
+ *
+ * The access method is chosen here: contiguous pins of one port listed in increasing order are
+ * accessed as a field (GPIO_writePortField()), other pins one by one. GPIO_initPinGroupLut()
+ * additionally accesses scattered pins of one port through a lookup table.
+ *
+ * @param[out] Group The pin group to initialize.
+ * @param[in] Pins The pins of the group.
+ * @param[in] NumOfPins Number of pins, up to GPIO_PINGROUP_MAX_PINS.
+ * @return MCAL_ERROR if there are too many pins or a pin is listed twice, MCAL_OK otherwise @ref MCAL_Status_t.
+ */
+MCAL_Status_t GPIO_initPinGroup(GPIO_PinGroup_t *Group, GPIO_PinID_t const *Pins, uint32_t NumOfPins);
+
+/**
+ * @brief Builds a pin group like GPIO_initPinGroup(), scattered pins of one port are written through a lookup table.
+ *
+ * When the pins are all on one port, not contiguous and at most GPIO_PINGROUP_LUT_MAX_PINS, the BSRR word
+ * of each value is built now in @p Lut, which the group keeps using. Otherwise @p Lut is left unused.
+ *
+ * @param[out] Group The pin group to initialize.
+ * @param[in] Pins The pins of the group.
+ * @param[in] NumOfPins Number of pins, up to GPIO_PINGROUP_MAX_PINS.
+ * @param[out] Lut Storage of the lookup table, GPIO_PINGROUP_LUT_SIZE(NumOfPins) words living as long as the group.
+ * @return MCAL_ERROR if there are too many pins or a pin is listed twice, MCAL_OK otherwise @ref MCAL_Status_t.
+ */
+MCAL_Status_t GPIO_initPinGroupLut(GPIO_PinGroup_t *Group, GPIO_PinID_t const *Pins, uint32_t NumOfPins, uint32_t *Lut);
+
+/**
+ * @brief Writes a value to all the pins of a group.
+ *
+ * Each port involved is updated with a single BSRR store, its pins change state at the same time
+ * and the write is safe against interrupts touching other pins of the port.
+ *
+ * @param[in] Group The pin group, initialized by GPIO_initPinGroup().
+ * @param[in] Value Bit i is the state of the i-th pin of the group.
+ * @return Status indicating the success or failure of the write @ref MCAL_Status_t.
+ */
+MCAL_Status_t GPIO_writePinGroup(GPIO_PinGroup_t const *Group, uint32_t Value);
+
+/**
+ * @brief Reads the value of all the pins of a group.
+ *
+ * Each port involved is sampled with a single IDR read.
+ *
+ * @param[in] Group The pin group, initialized by GPIO_initPinGroup().
+ * @return Bit i is the state of the i-th pin of the group.
+ */
+uint32_t GPIO_readPinGroup(GPIO_PinGroup_t const *Group);
+
+/**
+ * @brief Changes the mode of all the pins of a group, e.g. to turn a bidirectional bus around.
+ *
+ * The speed of the pins is kept, each port involved costs one read-modify-write of MODER, PUPDR and OTYPER.
+ *
+ * @param[in] Group The pin group, initialized by GPIO_initPinGroup().
+ * @param[in] PinMode The new mode of the pins, an input, analog or output mode.
+ * @return MCAL_ERROR for an alternate function mode, MCAL_OK otherwise @ref MCAL_Status_t.
+ */
+MCAL_Status_t GPIO_setPinGroupMode(GPIO_PinGroup_t const *Group, GPIO_PinMode_t PinMode);
+
 /**
  * @brief Gets the current value of a GPIO pin.
  *
@@ -197,4 +420,25 @@ MCAL_Status_t GPIO_setPinValue(GPIO_Port_t Port, GPIO_Pin_t PinNumber, GPIO_PinS
  */
 GPIO_PinState_t GPIO_getPinValue(GPIO_Port_t Port, GPIO_Pin_t PinNumber);
 
+/**
+ * @brief Gets the current value of all the pins of a GPIO port.
+ *
+ * The port is sampled with a single IDR read, so the levels of its pins are coherent.
+ *
+ * @param[in] Port The GPIO port.
+ * @return The levels of the pins, bit n is the state of pin n.
+ */
+uint16_t GPIO_getPortValue(GPIO_Port_t Port);
+
+/**
+ * @brief Gets the mode a GPIO pin is configured in.
+ *
+ * Lets a module check that the pins it drives were configured by someone else, e.g. Board_init().
+ *
+ * @param[in] Port The GPIO port to which the pin belongs.
+ * @param[in] PinNumber The specific GPIO pin number.
+ * @return The mode of the pin @ref GPIO_PinMode_t, the output type is only reported for the output and alternate modes.
+ */
+GPIO_PinMode_t GPIO_getPinMode(GPIO_Port_t Port, GPIO_Pin_t PinNumber);
+
 #endif // MCAL_GPIO_GPIO_H_
@@ -0,0 +1,138 @@
+/**
+ * @file GPIO_Pin.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Compile-time GPIO pin handles
+ * @version 0.1
+ * @date 2024-04-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * A pin handle is the base address of the port and the mask of the pin, both computed at build time
+ * and validated with _Static_assert. The inline accessors fold into a single register access when the
+ * handle is a constant, instead of the port table lookup, shift and checks of GPIO_setPinValue() and
+ * GPIO_getPinValue().
+ *
+ * The pin must have been configured with GPIO_initPin() beforehand.
+ */
+#ifndef MCAL_GPIO_GPIO_PIN_H_
+#define MCAL_GPIO_GPIO_PIN_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "MCAL/GPIO/GPIO.h"
+#include "MCAL/GPIO/GPIO_Reg.h"
+#include "MCAL/stm32f401.h"
+#include <stddef.h>
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Fails the build when @p Port or @p Pin is not a valid constant, evaluates to nothing.
+ */
+#define GPIO_PIN_STATIC_CHECK(Port, Pin)                                                        \
+    ((void)sizeof(struct                                                                        \
+    {                                                                                           \
+        _Static_assert(((Port) >= GPIO_GPIOA) && ((Port) <= GPIO_GPIOH), "invalid GPIO port");  \
+        _Static_assert(((Pin) >= GPIO_PIN0) && ((Pin) <= GPIO_PIN15), "invalid GPIO pin");      \
+        int Dummy;                                                                              \
+    }))
+
+/**
+ * @brief Handle of the pin @p Pin of port @p Port, both must be constants.
+ *
+ * @param Port The GPIO port @ref GPIO_Port_t.
+ * @param Pin The GPIO pin number @ref GPIO_Pin_t.
+ */
+#define GPIO_PIN_HANDLE(Port, Pin)                                                              \
+    (GPIO_PIN_STATIC_CHECK(Port, Pin),                                                          \
+     (GPIO_PinHandle_t){(GPIO_TypeDef volatile *)GPIO_PORT_BASE(Port), 1UL << (Pin)})
+
+/**
+ * @brief Bit-band alias word of the ODR bit of a pin, both must be constants.
+ */
+#define GPIO_PIN_ODR_BITBAND(Port, Pin) \
+    BITBAND_PERIPH(GPIO_PORT_BASE(Port) + offsetof(GPIO_TypeDef, ODR), (Pin))
+
+/**
+ * @brief Bit-band alias word of the IDR bit of a pin, both must be constants.
+ */
+#define GPIO_PIN_IDR_BITBAND(Port, Pin) \
+    BITBAND_PERIPH(GPIO_PORT_BASE(Port) + offsetof(GPIO_TypeDef, IDR), (Pin))
+
+/**
+ * @brief Drives a pin through the bit-band alias of its ODR bit, a single store.
+ * @note Prefer GPIO_pinWrite(), the bus turns the bit-band store into a read-modify-write of ODR
+ * where BSRR is written once.
+ */
+#define GPIO_pinWriteBitBand(Port, Pin, PinState) \
+    (GPIO_PIN_STATIC_CHECK(Port, Pin), (void)(*GPIO_PIN_ODR_BITBAND(Port, Pin) = (uint32_t)(PinState)))
+
+/**
+ * @brief Reads a pin through the bit-band alias of its IDR bit, a single load returning 0 or 1.
+ */
+#define GPIO_pinReadBitBand(Port, Pin) \
+    (GPIO_PIN_STATIC_CHECK(Port, Pin), (GPIO_PinState_t)*GPIO_PIN_IDR_BITBAND(Port, Pin))
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Handle of a GPIO pin, built with GPIO_PIN_HANDLE().
+ */
+typedef struct
+{
+    GPIO_TypeDef volatile *Regs;    /**< Registers of the port. */
+    uint32_t Mask;                  /**< Mask of the pin in the port registers. */
+} GPIO_PinHandle_t;
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Drives the pin high, a single BSRR store.
+ */
+static inline void GPIO_pinSet(GPIO_PinHandle_t Pin)
+{
+    Pin.Regs->BSRR = Pin.Mask;
+}
+
+/**
+ * @brief Drives the pin low, a single BSRR store.
+ */
+static inline void GPIO_pinReset(GPIO_PinHandle_t Pin)
+{
+    Pin.Regs->BSRR = Pin.Mask << 16;
+}
+
+/**
+ * @brief Drives the pin to @p PinState, a single BSRR store.
+ */
+static inline void GPIO_pinWrite(GPIO_PinHandle_t Pin, GPIO_PinState_t PinState)
+{
+    Pin.Regs->BSRR = (PinState == GPIO_PINSTATE_SET) ? Pin.Mask : (Pin.Mask << 16);
+}
+
+/**
+ * @brief Inverts the output level of the pin, an ODR load followed by a BSRR store.
+ * @note Other pins of the port are not affected even if an interrupt writes them in between.
+ */
+static inline void GPIO_pinToggle(GPIO_PinHandle_t Pin)
+{
+    Pin.Regs->BSRR = (Pin.Regs->ODR & Pin.Mask) ? (Pin.Mask << 16) : Pin.Mask;
+}
+
+/**
+ * @brief Reads the input level of the pin, a single IDR load.
+ */
+static inline GPIO_PinState_t GPIO_pinRead(GPIO_PinHandle_t Pin)
+{
+    return (Pin.Regs->IDR & Pin.Mask) ? GPIO_PINSTATE_SET : GPIO_PINSTATE_RESET;
+}
+
+
+#endif // MCAL_GPIO_GPIO_PIN_H_
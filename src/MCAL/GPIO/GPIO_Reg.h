@@ -0,0 +1,66 @@
+/**
+ * @file GPIO_Reg.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief GPIO register layout and base addresses
+ * @version 0.1
+ * @date 2024-04-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Shared by GPIO.c and the inline pin handles of GPIO_Pin.h, application code should not use it directly.
+ */
+#ifndef MCAL_GPIO_GPIO_REG_H_
+#define MCAL_GPIO_GPIO_REG_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/************************************/
+/***************Registers************/
+/************************************/
+#define GPIOA_BASE (0x40020000UL)
+#define GPIOB_BASE (0x40020400UL)
+#define GPIOC_BASE (0x40020800UL)
+#define GPIOD_BASE (0x40020C00UL)
+#define GPIOE_BASE (0x40021000UL)
+#define GPIOH_BASE (0x40021C00UL)
+
+/**
+ * @brief Base address of a port from its @ref GPIO_Port_t value, a constant expression when @p Port is.
+ */
+#define GPIO_PORT_BASE(Port) (((Port) == GPIO_GPIOH) ? GPIOH_BASE : (GPIOA_BASE + ((uint32_t)(Port) * 0x400UL)))
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/***********************************************************/
+/******************Peripheral Register GPIO******************/
+/***********************************************************/
+
+/**
+ * @brief Structure representing the GPIO peripheral registers.
+ *
+ * This structure encapsulates the various registers associated with a GPIO port.
+ */
+typedef struct {
+    uint32_t MODER;     /**< GPIO port mode register. */
+    uint32_t OTYPER;    /**< GPIO port output type register. */
+    uint32_t OSPEEDR;   /**< GPIO port output speed register. */
+    uint32_t PUPDR;     /**< GPIO port pull-up/pull-down register. */
+    uint32_t IDR;       /**< GPIO port input data register. */
+    uint32_t ODR;       /**< GPIO port output data register. */
+    uint32_t BSRR;      /**< GPIO port bit set/reset register. */
+    uint32_t LCKR;      /**< GPIO port lock register. */
+    uint32_t AFRL;      /**< GPIO port alternate function low register. */
+    uint32_t AFRH;      /**< GPIO port alternate function high register. */
+} GPIO_TypeDef;
+
+
+#endif // MCAL_GPIO_GPIO_REG_H_
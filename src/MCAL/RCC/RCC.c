@@ -14,6 +14,7 @@
 /********************************************************************************************************/
 #include "MCAL/RCC/RCC.h"
 #include "assertparam.h"
+#include <stddef.h>
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
 /********************************************************************************************************/
@@ -53,6 +54,9 @@
 
 #define RCC ((RCC_TypeDef* const)(RCC_BASE))
 
+/* Bit-band alias word of a bit of RCC_CR */
+#define RCC_CR_BITBAND(Bit) BITBAND_PERIPH(RCC_BASE + offsetof(RCC_TypeDef, CR), (Bit))
+
 /************************************/
 /***************Validators************/
 /************************************/
@@ -186,21 +190,23 @@ MCAL_Status_t RCC_enableClock(RCC_ClockTypeDef Clock)
 {
     assert_param(IS_RCC_CLOCK(Clock));
 
+    /* Each clock is a single ON bit followed by its ready flag, both accessed through their bit-band alias */
+    uint32_t clockOnBit = (uint32_t)__builtin_ctz((uint32_t)Clock);
+
     /* Enable the clock*/
-    RCC->CR |= Clock;
-    uint32_t clockStatusMask = ((uint32_t)Clock << 1UL);
+    *RCC_CR_BITBAND(clockOnBit) = 1;
 
     uint32_t timeout = RCC_TIMEOUT_VAL;
-    while(!(RCC->CR & clockStatusMask) && timeout){timeout--;}
+    while(!*RCC_CR_BITBAND(clockOnBit + 1) && timeout){timeout--;}
 
-    return (RCC->CR & clockStatusMask)? MCAL_OK : MCAL_TIMEOUT;
+    return (*RCC_CR_BITBAND(clockOnBit + 1))? MCAL_OK : MCAL_TIMEOUT;
 }
 
 MCAL_Status_t RCC_disableClock(RCC_ClockTypeDef Clock)
 {
     assert_param(IS_RCC_CLOCK(Clock));
 
-    RCC->CR &= ~Clock;
+    *RCC_CR_BITBAND(__builtin_ctz((uint32_t)Clock)) = 0;
     return MCAL_OK;
 }
 
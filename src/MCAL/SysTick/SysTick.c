@@ -20,6 +20,12 @@
 #define SYSTICK_CTRL_CLKSOURCE_MASK (0x4UL)
 #define SYSTICK_CTRL_TICKINT_MASK (0X2UL)
 #define SYSTICK_CTRL_ENABLE_MASK (0X1UL)
+#define SYSTICK_CTRL_COUNTFLAG_MASK (0x10000UL)
+
+#define SYSTICK_MAX_RELOAD (0xFFFFFFUL)
+
+/* Shortest countdown programmed by SysTick_restartTimerMS(), used when the expiry is already due */
+#define SYSTICK_MIN_COUNTS (64UL)
 
 
 /************************************/
@@ -79,6 +85,37 @@ typedef struct
 /********************************************************************************************************/
 static SysTick_CallBackFn_t callBackFunction = NULL;
 
+/**
+ * @brief CTRL with the timer stopped, as last written by SysTick_init().
+ * 
+ * CTRL sits on the private peripheral bus, out of the bit-band region, so the enable bit is
+ * changed by storing this value instead of a read-modify-write of the register.
+ */
+static uint32_t ctrlConfig = 0;
+
+/**
+ * @brief Counts from the reference point to the start of the current countdown.
+ * 
+ * The reference point is set by SysTick_startTimerMS() and moved by SysTick_advanceReferenceMS(),
+ * it is negative once the reference has moved past the start of the countdown.
+ */
+static int32_t referenceCounts = 0;
+
+/**
+ * @brief LOAD of a full period, a shortened countdown is given it back once it expires.
+ */
+static uint32_t periodLoad = 0;
+
+/**
+ * @brief Set while the countdown is shorter than periodLoad.
+ */
+static uint32_t isShortened = 0;
+
+/**
+ * @brief Set once the elapsed time is used, the handler then accounts every expiry.
+ */
+static uint32_t isReferenceUsed = 0;
+
 
 /********************************************************************************************************/
 /*****************************************Static Functions Prototype*************************************/
@@ -90,7 +127,49 @@ static SysTick_CallBackFn_t callBackFunction = NULL;
  */
 static void stopSysTick()
 {
-    SYSTICK->CTRL &= ~(SYSTICK_CTRL_ENABLE_MASK);
+    SYSTICK->CTRL = ctrlConfig;
+}
+
+/**
+ * @brief Returns the number of SysTick counts in one millisecond for the selected clock source.
+ */
+static uint32_t getCountsPerMS(void)
+{
+    uint32_t freq = (ctrlConfig & SYSTICK_CTRL_CLKSOURCE_MASK) ? SYSTICK_AHB_CLK : SYSTICK_AHB_CLK / 8;
+    return freq / 1000;
+}
+
+/**
+ * @brief Returns the counts elapsed since the reference point, the SysTick interrupt must be masked.
+ * 
+ * COUNTFLAG tells whether the counter expired since it was last checked, the countdown then
+ * restarted at that expiry. The handler checks it too, so each expiry is accounted once.
+ */
+static uint32_t getCountsSinceReference(void)
+{
+    uint32_t val = SYSTICK->VAL;
+
+    if(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG_MASK)
+    {
+        referenceCounts += (int32_t)(SYSTICK->LOAD + 1);
+        val = SYSTICK->VAL;
+    }
+
+    /* The counter sits at 0 from the start of a countdown until the first count reloads it */
+    return (uint32_t)(referenceCounts + (int32_t)(val ? (SYSTICK->LOAD + 1 - val) : 0));
+}
+
+/**
+ * @brief Starts a countdown of @p load + 1 counts now, keeping the reference point.
+ */
+static void restartCountdown(uint32_t load)
+{
+    referenceCounts = (int32_t)getCountsSinceReference();
+
+    stopSysTick();
+    SYSTICK->LOAD = load;
+    SYSTICK->VAL = 0;
+    SYSTICK->CTRL = ctrlConfig | SYSTICK_CTRL_ENABLE_MASK;
 }
 
 
@@ -107,6 +186,7 @@ void SysTick_init(SysTick_Config_t const *config)
     CTRL = (CTRL & SYSTICK_CTRL_CLKSOURCE_MASK) | config->ClockSource;
     CTRL = (CTRL & SYSTICK_CTRL_TICKINT_MASK) | config->ExceptionState;
 
+    ctrlConfig = CTRL & ~SYSTICK_CTRL_ENABLE_MASK;
     SYSTICK->CTRL = CTRL;
 
     callBackFunction = config->CallbackFunction;
@@ -117,18 +197,55 @@ void SysTick_startTimerMS(uint32_t timeMS)
 
     stopSysTick();
 
-    uint64_t freq = (SYSTICK->CTRL & SYSTICK_CTRL_CLKSOURCE_MASK) ? SYSTICK_AHB_CLK : SYSTICK_AHB_CLK / 8;
-    SYSTICK->LOAD = ((freq / 1000) * (timeMS)) - 1;
+    periodLoad = (getCountsPerMS() * (timeMS)) - 1;
+    isShortened = 0;
+    referenceCounts = 0;
+    SYSTICK->LOAD = periodLoad;
     SYSTICK->VAL = 0;
-    SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
+    SYSTICK->CTRL = ctrlConfig | SYSTICK_CTRL_ENABLE_MASK;
+}
+
+void SysTick_restartTimerMS(uint32_t timeMS)
+{
+    assert_param(timeMS <= SysTick_getMaxTimeMS());
+
+    uint32_t period = getCountsPerMS() * timeMS;
+    uint32_t elapsed = getCountsSinceReference();
+
+    isReferenceUsed = 1;
+
+    /* An expiry already due is programmed as a single short countdown, never as a tiny reload */
+    uint32_t remaining = (period > (elapsed + SYSTICK_MIN_COUNTS)) ? (period - elapsed) : SYSTICK_MIN_COUNTS;
+
+    periodLoad = period - 1;
+    isShortened = (remaining != period);
+    restartCountdown(remaining - 1);
+}
+
+void SysTick_advanceReferenceMS(uint32_t timeMS)
+{
+    referenceCounts -= (int32_t)(getCountsPerMS() * timeMS);
+}
+
+uint32_t SysTick_getMaxTimeMS(void)
+{
+    return (SYSTICK_MAX_RELOAD + 1) / getCountsPerMS();
+}
+
+uint32_t SysTick_getElapsedTimeMS(void)
+{
+    isReferenceUsed = 1;
+    return getCountsSinceReference() / getCountsPerMS();
 }
 void SysTick_startTickCounter(uint32_t ticks)
 {
     assert_param(IS_VALID_TICK(ticks));
 
     stopSysTick();
+    periodLoad = ticks;
+    isShortened = 0;
     SYSTICK->LOAD = ticks;
-    SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
+    SYSTICK->CTRL = ctrlConfig | SYSTICK_CTRL_ENABLE_MASK;
 }
 
 uint32_t SysTick_currentTick(void)
@@ -144,7 +261,22 @@ void SysTick_stop(void)
 
 void SysTick_Handler(void)
 {
-    
+    /* The counter already reloaded the LOAD of a shortened countdown, the next ones get the full period back */
+    if(isShortened)
+    {
+        isShortened = 0;
+        restartCountdown(periodLoad);
+    }
+    else if(isReferenceUsed)
+    {
+        /* Accounts the expiry so the elapsed time stays exact across several of them */
+        (void)getCountsSinceReference();
+    }
+    else
+    {
+        /* Periodic timer, nothing to account */
+    }
+
     if(callBackFunction != NULL )
         callBackFunction();
 
@@ -60,10 +60,50 @@ void SysTick_init(SysTick_Config_t const *config);
 /**
  * @brief Starts the SysTick timer with a specified duration in milliseconds.
  * 
+ * The start of the timer becomes the reference point of SysTick_restartTimerMS() and
+ * SysTick_getElapsedTimeMS().
+ * 
  * @param timeMS Time duration in milliseconds.
  */
 void SysTick_startTimerMS(uint32_t timeMS);
 
+/**
+ * @brief Restarts the SysTick timer so it expires @p timeMS after the reference point.
+ * 
+ * The counts that elapsed since the reference point are subtracted from the first period,
+ * so the time spent between the reference and this call does not accumulate as drift.
+ * An expiry already due is programmed as a single short countdown, the periods after it
+ * last @p timeMS again.
+ * 
+ * @param timeMS Time duration in milliseconds, measured from the reference point.
+ * @note timeMS must not exceed SysTick_getMaxTimeMS().
+ * @note The SysTick interrupt must be masked.
+ */
+void SysTick_restartTimerMS(uint32_t timeMS);
+
+/**
+ * @brief Moves the reference point @p timeMS later, once that much time has been accounted by the caller.
+ * 
+ * @param timeMS Time duration in milliseconds, at most SysTick_getElapsedTimeMS().
+ * @note The SysTick interrupt must be masked.
+ */
+void SysTick_advanceReferenceMS(uint32_t timeMS);
+
+/**
+ * @brief Retrieves the longest duration SysTick_startTimerMS() can be programmed with.
+ *
+ * @return The maximum timer duration in milliseconds for the selected clock source.
+ */
+uint32_t SysTick_getMaxTimeMS(void);
+
+/**
+ * @brief Retrieves the whole milliseconds elapsed since the reference point, expiries included.
+ *
+ * @return The elapsed time in milliseconds, rounded down.
+ * @note The SysTick interrupt must be masked.
+ */
+uint32_t SysTick_getElapsedTimeMS(void);
+
 /**
  * @brief Starts the SysTick timer with a specified number of ticks.
  * 
@@ -0,0 +1,168 @@
+/**
+ * @file TIM.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Implementation of the general purpose and advanced timers, time base and DMA requests
+ * @version 0.1
+ * @date 2024-04-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "TIM.h"
+#include "assertparam.h"
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/************************************/
+/***************Registers************/
+/************************************/
+#define TIM1_BASE   (0x40010000UL)
+#define TIM2_BASE   (0x40000000UL)
+#define TIM3_BASE   (0x40000400UL)
+#define TIM4_BASE   (0x40000800UL)
+#define TIM5_BASE   (0x40000C00UL)
+#define TIM9_BASE   (0x40014000UL)
+#define TIM10_BASE  (0x40014400UL)
+#define TIM11_BASE  (0x40014800UL)
+
+#define CR1_CEN     (1UL << 0)
+#define CR1_URS     (1UL << 2)
+#define CR1_ARPE    (1UL << 7)
+#define DIER_UDE    (1UL << 8)
+#define SR_UIF      (1UL << 0)
+#define EGR_UG      (1UL << 0)
+
+#define MAX_PRESCALER       (0x10000UL)
+#define MAX_PERIOD_16BITS   (0x10000UL)
+
+/************************************/
+/***************Validators***********/
+/************************************/
+#define IS_TIM_TIMER(TIMER) ((TIMER) < _TIM_NUM_OF_TIMERS)
+
+#define IS_TIM_32BITS(TIMER) (((TIMER) == TIM_TIM2) || ((TIMER) == TIM_TIM5))
+
+#define IS_TIM_PRESCALER(PRESCALER) (((PRESCALER) >= 1) && ((PRESCALER) <= MAX_PRESCALER))
+
+/* The 32-bit timers accept any period above one count, it is stored minus one */
+#define IS_TIM_PERIOD(TIMER, PERIOD) (((PERIOD) >= 2) && (IS_TIM_32BITS(TIMER) || ((PERIOD) <= MAX_PERIOD_16BITS)))
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Structure representing the timer registers, the layout of TIM1 which the other timers share.
+ */
+typedef struct
+{
+    uint32_t CR1;       /**< Control register 1. */
+    uint32_t CR2;       /**< Control register 2. */
+    uint32_t SMCR;      /**< Slave mode control register. */
+    uint32_t DIER;      /**< DMA/interrupt enable register. */
+    uint32_t SR;        /**< Status register, write 0 to clear. */
+    uint32_t EGR;       /**< Event generation register. */
+    uint32_t CCMR1;     /**< Capture/compare mode register 1. */
+    uint32_t CCMR2;     /**< Capture/compare mode register 2. */
+    uint32_t CCER;      /**< Capture/compare enable register. */
+    uint32_t CNT;       /**< Counter. */
+    uint32_t PSC;       /**< Prescaler, divides by PSC + 1. */
+    uint32_t ARR;       /**< Auto-reload register, the counter overflows after ARR + 1 counts. */
+    uint32_t RCR;       /**< Repetition counter register (TIM1 only). */
+    uint32_t CCR[4];    /**< Capture/compare registers. */
+    uint32_t BDTR;      /**< Break and dead-time register (TIM1 only). */
+    uint32_t DCR;       /**< DMA control register. */
+    uint32_t DMAR;      /**< DMA address for full transfer. */
+    uint32_t OR;        /**< Option register (TIM2, TIM5 and TIM11). */
+} TIM_t;
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+static TIM_t volatile *const TIMS[_TIM_NUM_OF_TIMERS] =
+{
+    [TIM_TIM1]  = (TIM_t volatile *const)TIM1_BASE,
+    [TIM_TIM2]  = (TIM_t volatile *const)TIM2_BASE,
+    [TIM_TIM3]  = (TIM_t volatile *const)TIM3_BASE,
+    [TIM_TIM4]  = (TIM_t volatile *const)TIM4_BASE,
+    [TIM_TIM5]  = (TIM_t volatile *const)TIM5_BASE,
+    [TIM_TIM9]  = (TIM_t volatile *const)TIM9_BASE,
+    [TIM_TIM10] = (TIM_t volatile *const)TIM10_BASE,
+    [TIM_TIM11] = (TIM_t volatile *const)TIM11_BASE,
+};
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+MCAL_Status_t TIM_initTimebase(TIM_TimebaseConfig_t const *TimebaseConfig)
+{
+    assert_param(TimebaseConfig);
+    assert_param(IS_TIM_TIMER(TimebaseConfig->Timer));
+    assert_param(IS_TIM_PRESCALER(TimebaseConfig->Prescaler));
+    assert_param(IS_TIM_PERIOD(TimebaseConfig->Timer, TimebaseConfig->Period));
+
+    TIM_t volatile *const TIM = TIMS[TimebaseConfig->Timer];
+
+    /* Stopped, buffered period, the update generated below does not request anything */
+    TIM->CR1 = CR1_ARPE | CR1_URS;
+    TIM->PSC = TimebaseConfig->Prescaler - 1;
+    TIM->ARR = TimebaseConfig->Period - 1;
+
+    /* The prescaler is buffered too, loading both of them now */
+    TIM->EGR = EGR_UG;
+    TIM->SR = (uint32_t)~SR_UIF;
+
+    return MCAL_OK;
+}
+
+MCAL_Status_t TIM_setPeriod(TIM_Timer_t Timer, uint32_t Period)
+{
+    assert_param(IS_TIM_TIMER(Timer));
+    assert_param(IS_TIM_PERIOD(Timer, Period));
+
+    TIMS[Timer]->ARR = Period - 1;
+    return MCAL_OK;
+}
+
+MCAL_Status_t TIM_start(TIM_Timer_t Timer)
+{
+    assert_param(IS_TIM_TIMER(Timer));
+
+    TIM_t volatile *const TIM = TIMS[Timer];
+
+    TIM->CNT = 0;
+    TIM->CR1 |= CR1_CEN;
+    return MCAL_OK;
+}
+
+MCAL_Status_t TIM_stop(TIM_Timer_t Timer)
+{
+    assert_param(IS_TIM_TIMER(Timer));
+
+    TIMS[Timer]->CR1 &= ~CR1_CEN;
+    return MCAL_OK;
+}
+
+MCAL_Status_t TIM_enableUpdateDMA(TIM_Timer_t Timer)
+{
+    assert_param(IS_TIM_TIMER(Timer));
+
+    TIMS[Timer]->DIER |= DIER_UDE;
+    return MCAL_OK;
+}
+
+MCAL_Status_t TIM_disableUpdateDMA(TIM_Timer_t Timer)
+{
+    assert_param(IS_TIM_TIMER(Timer));
+
+    TIMS[Timer]->DIER &= ~DIER_UDE;
+    return MCAL_OK;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file TIM.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Header file for the general purpose and advanced timers, time base and DMA requests
+ * @version 0.1
+ * @date 2024-04-12
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef MCAL_TIM_TIM_H_
+#define MCAL_TIM_TIM_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "MCAL/stm32f401.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enumeration for the timers of the STM32F401.
+ */
+typedef enum
+{
+    TIM_TIM1,       /**< Advanced-control timer, APB2 */
+    TIM_TIM2,       /**< 32-bit general purpose timer, APB1 */
+    TIM_TIM3,       /**< 16-bit general purpose timer, APB1 */
+    TIM_TIM4,       /**< 16-bit general purpose timer, APB1 */
+    TIM_TIM5,       /**< 32-bit general purpose timer, APB1 */
+    TIM_TIM9,       /**< 16-bit general purpose timer, APB2 */
+    TIM_TIM10,      /**< 16-bit general purpose timer, APB2 */
+    TIM_TIM11,      /**< 16-bit general purpose timer, APB2 */
+    _TIM_NUM_OF_TIMERS,     /**< Total number of timers ^^DO NOT MODIFY^^ */
+} TIM_Timer_t;
+
+/**
+ * @brief Structure for the configuration of the time base of a timer.
+ * 
+ * The counter runs at TimerClock / Prescaler and overflows, raising an update event, every Period counts.
+ */
+typedef struct
+{
+    TIM_Timer_t Timer;      /**< Timer */
+    uint32_t    Prescaler;  /**< Division of the timer clock, 1 to 65536 */
+    uint32_t    Period;     /**< Counts between two update events, 2 to 65536 (2^32 on TIM2 and TIM5) */
+} TIM_TimebaseConfig_t;
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Configures the time base of a timer, the timer is left stopped.
+ * 
+ * The update event is only raised by counter overflows, the one generated here to load the
+ * prescaler does not trigger a DMA request or an interrupt.
+ * 
+ * @param TimebaseConfig Configuration of the time base.
+ * @note The clock of the timer must be enabled beforehand.
+ * @return Status indicating the success or failure of the initialization @ref MCAL_Status_t.
+ */
+MCAL_Status_t TIM_initTimebase(TIM_TimebaseConfig_t const *TimebaseConfig);
+
+/**
+ * @brief Changes the number of counts between two update events.
+ * 
+ * The new period is buffered and takes effect at the next update event, the running period is
+ * never cut short.
+ * 
+ * @param Timer The timer.
+ * @param Period Counts between two update events, same range as @ref TIM_TimebaseConfig_t.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t TIM_setPeriod(TIM_Timer_t Timer, uint32_t Period);
+
+/**
+ * @brief Restarts the counter from zero.
+ * 
+ * @param Timer The timer.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t TIM_start(TIM_Timer_t Timer);
+
+/**
+ * @brief Stops the counter.
+ * 
+ * @param Timer The timer.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t TIM_stop(TIM_Timer_t Timer);
+
+/**
+ * @brief Makes every update event request a transfer from the DMA stream mapped to the update of the timer.
+ * 
+ * @param Timer The timer.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t TIM_enableUpdateDMA(TIM_Timer_t Timer);
+
+/**
+ * @brief Stops the DMA requests of the update events.
+ * 
+ * @param Timer The timer.
+ * @return Status indicating the success or failure of the operation @ref MCAL_Status_t.
+ */
+MCAL_Status_t TIM_disableUpdateDMA(TIM_Timer_t Timer);
+
+
+#endif // MCAL_TIM_TIM_H_
@@ -16,6 +16,79 @@
 /************************************************Defines*************************************************/
 /********************************************************************************************************/
 
+/************************************/
+/**********Core Instructions*********/
+/************************************/
+
+#ifndef HOST_BUILD
+
+/**
+ * @brief Masks all configurable interrupts (sets PRIMASK).
+ */
+#define CPU_DISABLE_IRQ()           __asm volatile ("cpsid i" : : : "memory")
+
+/**
+ * @brief Unmasks all configurable interrupts (clears PRIMASK).
+ */
+#define CPU_ENABLE_IRQ()            __asm volatile ("cpsie i" : : : "memory")
+
+/**
+ * @brief Suspends execution until an interrupt becomes pending.
+ * @note A pending interrupt wakes the core even while PRIMASK is set.
+ */
+#define CPU_WAIT_FOR_INTERRUPT()    __asm volatile ("wfi" : : : "memory")
+
+/**
+ * @brief Called by busy-waiting loops that have nothing to do until the next interrupt.
+ * @note Empty on the target, lets the simulated time advance in the host build.
+ */
+#define CPU_IDLE_HOOK()
+
+#else
+
+/* Host build, the core is simulated by host/Sim */
+void Sim_disableIrq(void);
+void Sim_enableIrq(void);
+void Sim_waitForInterrupt(void);
+void Sim_idle(void);
+
+#define CPU_DISABLE_IRQ()           Sim_disableIrq()
+#define CPU_ENABLE_IRQ()            Sim_enableIrq()
+#define CPU_WAIT_FOR_INTERRUPT()    Sim_waitForInterrupt()
+#define CPU_IDLE_HOOK()             Sim_idle()
+
+#endif
+
+/**
+ * @brief Atomically ORs @p Mask into the word at @p Address.
+ * @note Compiles to an LDREX/STREX loop on the Cortex-M4, safe against interrupts without masking them.
+ */
+#define CPU_ATOMIC_OR(Address, Mask)            ((void)__atomic_fetch_or((Address), (Mask), __ATOMIC_SEQ_CST))
+
+/**
+ * @brief Atomically replaces the word at @p Address with @p Value and returns its previous value.
+ * @note Compiles to an LDREX/STREX loop on the Cortex-M4, safe against interrupts without masking them.
+ */
+#define CPU_ATOMIC_EXCHANGE(Address, Value)     __atomic_exchange_n((Address), (Value), __ATOMIC_SEQ_CST)
+
+/************************************/
+/*************Bit-banding************/
+/************************************/
+#define BITBAND_PERIPH_BASE     (0x40000000UL)
+#define BITBAND_PERIPH_ALIAS    (0x42000000UL)
+
+/**
+ * @brief Alias word of bit @p Bit of the peripheral register at @p Address, a constant when both are.
+ * 
+ * Writing 0 or 1 to the word clears or sets the bit with a single store, without a read-modify-write
+ * in software nor masking interrupts. Reading it returns the bit as 0 or 1.
+ * @note Only the peripherals at 0x40000000..0x400FFFFF are bit-banded, the core registers (SysTick,
+ * NVIC, SCB) of the private peripheral bus are not.
+ * @note The bus still performs a read-modify-write of the register, write-1-to-clear bits of the
+ * same register may be cleared by it.
+ */
+#define BITBAND_PERIPH(Address, Bit) \
+    ((uint32_t volatile *)(BITBAND_PERIPH_ALIAS + (((uint32_t)(uintptr_t)(Address) - BITBAND_PERIPH_BASE) * 32UL) + ((uint32_t)(Bit) * 4UL)))
 
 /********************************************************************************************************/
 /************************************************Types***************************************************/
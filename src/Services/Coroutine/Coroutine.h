@@ -0,0 +1,133 @@
+/**
+ * @file Coroutine.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Stackless coroutines for writing scheduler runnables as sequential code.
+ * @version 0.1
+ * @date 2024-04-03
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * A coroutine body is placed between CO_BEGIN() and CO_END() inside a runnable callback.
+ * Each blocking primitive saves the resume point and returns to the scheduler, the next
+ * activation of the runnable jumps back to it.
+ * 
+ * Waiting costs nothing per tick: CO_WAIT_UNTIL() suspends the runnable until it is signaled
+ * with Sched_signal() and CO_SLEEP_MS() defers its next activation.
+ * 
+ * @note The body is a switch statement, so local variables are not preserved across a blocking
+ *       primitive (use static ones) and the body itself must not contain switch statements.
+ */
+#ifndef SERVICES_COROUTINE_COROUTINE_H_
+#define SERVICES_COROUTINE_COROUTINE_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "Services/Scheduler/Scheduler.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/* Resume points are case labels reached by falling through on the first pass */
+#if defined(__GNUC__) && (__GNUC__ >= 7)
+#define CO_FALLTHROUGH              __attribute__((fallthrough))
+#else
+#define CO_FALLTHROUGH              ((void)0)
+#endif
+
+/**
+ * @brief Initializer of a coroutine context, the coroutine starts from CO_BEGIN().
+ */
+#define CO_INIT                     {0, 0}
+
+/**
+ * @brief Starts the body of the coroutine.
+ * 
+ * @param Co Pointer to the Co_t context of the coroutine.
+ */
+#define CO_BEGIN(Co)                switch((Co)->ResumePoint) { case 0:
+
+/**
+ * @brief Ends the body of the coroutine, the next activation starts it over from CO_BEGIN().
+ * 
+ * @param Co Pointer to the Co_t context of the coroutine.
+ */
+#define CO_END(Co)                  } (Co)->ResumePoint = 0
+
+/**
+ * @brief Returns to the scheduler, execution continues after it on the next activation.
+ * 
+ * @param Co Pointer to the Co_t context of the coroutine.
+ */
+#define CO_YIELD(Co)                                                            \
+    do                                                                          \
+    {                                                                           \
+        (Co)->ResumePoint = __LINE__;                                           \
+        return;                                                                 \
+        case __LINE__:;                                                         \
+    } while(0)
+
+/**
+ * @brief Blocks until @p Cond is true.
+ * 
+ * The runnable is suspended while @p Cond is false, whoever makes it true must call
+ * Sched_signal() with the runnable ID so the condition is checked again.
+ * 
+ * @param Co Pointer to the Co_t context of the coroutine.
+ * @param Cond Condition to wait for.
+ */
+#define CO_WAIT_UNTIL(Co, Cond)                                                 \
+    do                                                                          \
+    {                                                                           \
+        (Co)->ResumePoint = __LINE__;                                           \
+        CO_FALLTHROUGH;                                                         \
+        case __LINE__:                                                          \
+        if(!(Cond))                                                             \
+        {                                                                       \
+            (void)Sched_suspend(Sched_getRunningID());                          \
+            return;                                                             \
+        }                                                                       \
+    } while(0)
+
+/**
+ * @brief Blocks for @p TimeMS milliseconds.
+ * 
+ * The runnable is not executed in the meantime, an early signal only makes it go back to sleep
+ * for the remaining time.
+ * 
+ * @param Co Pointer to the Co_t context of the coroutine.
+ * @param TimeMS Time to sleep in milliseconds.
+ */
+#define CO_SLEEP_MS(Co, TimeMS)                                                 \
+    do                                                                          \
+    {                                                                           \
+        (Co)->WakeTimeMS = Sched_getTimeMS() + (TimeMS);                        \
+        (Co)->ResumePoint = __LINE__;                                           \
+        CO_FALLTHROUGH;                                                         \
+        case __LINE__:                                                          \
+        if((int32_t)(Sched_getTimeMS() - (Co)->WakeTimeMS) < 0)                 \
+        {                                                                       \
+            (void)Sched_sleep(Sched_getRunningID(), (Co)->WakeTimeMS - Sched_getTimeMS()); \
+            return;                                                             \
+        }                                                                       \
+    } while(0)
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Context of a coroutine, must outlive the activations of the runnable (static storage).
+ */
+typedef struct
+{
+    uint32_t ResumePoint;   /**< Line to resume from, 0 for the beginning of the body */
+    uint32_t WakeTimeMS;    /**< Scheduler time at which the current CO_SLEEP_MS() ends */
+} Co_t;
+
+
+#endif // SERVICES_COROUTINE_COROUTINE_H_
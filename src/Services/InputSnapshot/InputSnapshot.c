@@ -0,0 +1,87 @@
+/**
+ * @file InputSnapshot.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Implementation of the GPIO input snapshot service
+ * @version 0.1
+ * @date 2024-04-10
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "InputSnapshot.h"
+#include "Services/Scheduler/Scheduler.h"
+#include "assertparam.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define NUM_OF_PORTS    ((uint32_t)GPIO_GPIOH + 1UL)
+
+/**
+ * @brief Validate that a port is sampled by the snapshot.
+ */
+#define IS_INPUTSNAPSHOT_PORT(PORT) (((uint32_t)(PORT) < NUM_OF_PORTS) && (INPUTSNAPSHOT_PORTS_MASK & (1UL << (PORT))))
+
+#define IS_GPIO_PIN(PIN) (((PIN) >= GPIO_PIN0) && ((PIN) <= GPIO_PIN15))
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Levels of the pins of each port at the start of the current tick, indexed by @ref GPIO_Port_t.
+ */
+static uint16_t Snapshot[NUM_OF_PORTS];
+
+/**
+ * @brief Set by InputSnapshot_init(), the snapshot reads 0 for every pin until then.
+ */
+static uint32_t IsInitialized;
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+InputSnapshot_Error_t InputSnapshot_init(void)
+{
+    InputSnapshot_update();
+    Sched_setTickHook(InputSnapshot_update);
+    IsInitialized = 1;
+
+    return INPUTSNAPSHOT_OK;
+}
+
+void InputSnapshot_update(void)
+{
+    uint32_t Port;
+
+    /* The mask is a constant, the loop reduces to one IDR read per configured port */
+    for(Port = 0; Port < NUM_OF_PORTS; Port++)
+    {
+        if(INPUTSNAPSHOT_PORTS_MASK & (1UL << Port))
+        {
+            Snapshot[Port] = GPIO_getPortValue((GPIO_Port_t)Port);
+        }
+    }
+}
+
+uint16_t InputSnapshot_getPortValue(GPIO_Port_t Port)
+{
+    assert_param(IsInitialized);
+    assert_param(IS_INPUTSNAPSHOT_PORT(Port));
+
+    return Snapshot[Port];
+}
+
+GPIO_PinState_t InputSnapshot_getPinValue(GPIO_Port_t Port, GPIO_Pin_t PinNumber)
+{
+    assert_param(IsInitialized);
+    assert_param(IS_INPUTSNAPSHOT_PORT(Port));
+    assert_param(IS_GPIO_PIN(PinNumber));
+
+    return (Snapshot[Port] & (1UL << PinNumber)) ? GPIO_PINSTATE_SET : GPIO_PINSTATE_RESET;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file InputSnapshot.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Header file for the GPIO input snapshot service
+ * @version 0.1
+ * @date 2024-04-10
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * The IDR of every configured port is read once at the start of each scheduler tick, the runnables
+ * of the tick then read their inputs from that snapshot. All the pins are sampled at the same time
+ * and the number of peripheral reads no longer grows with the number of inputs.
+ */
+#ifndef SERVICES_INPUTSNAPSHOT_INPUTSNAPSHOT_H_
+#define SERVICES_INPUTSNAPSHOT_INPUTSNAPSHOT_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "InputSnapshot_cfg.h"
+#include "MCAL/GPIO/GPIO.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enumeration for the input snapshot errors.
+ */
+typedef enum
+{
+    INPUTSNAPSHOT_OK,      /**< Operation successful */
+    INPUTSNAPSHOT_NOK      /**< Operation not successful */
+} InputSnapshot_Error_t;
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Takes the first snapshot and installs the refresh as the scheduler tick hook.
+ * 
+ * @note The pins must have been configured by Board_init() first. Calling it again only refreshes the snapshot.
+ * @return InputSnapshot_Error_t Error status after initialization.
+ */
+InputSnapshot_Error_t InputSnapshot_init(void);
+
+/**
+ * @brief Reads the IDR of each port of INPUTSNAPSHOT_PORTS_MASK once.
+ * 
+ * Called by the scheduler at the start of every tick, it only has to be called directly
+ * when the snapshot is used without the scheduler.
+ */
+void InputSnapshot_update(void);
+
+/**
+ * @brief Retrieves the levels of the pins of a port from the snapshot.
+ * 
+ * @note InputSnapshot_init() must have been called first.
+ * @param Port The GPIO port, it must be part of INPUTSNAPSHOT_PORTS_MASK.
+ * @return The levels of the pins, bit n is the state of pin n.
+ */
+uint16_t InputSnapshot_getPortValue(GPIO_Port_t Port);
+
+/**
+ * @brief Retrieves the level of a pin from the snapshot.
+ * 
+ * @note InputSnapshot_init() must have been called first.
+ * @param Port The GPIO port, it must be part of INPUTSNAPSHOT_PORTS_MASK.
+ * @param PinNumber The GPIO pin number.
+ * @return The state of the pin @ref GPIO_PinState_t.
+ */
+GPIO_PinState_t InputSnapshot_getPinValue(GPIO_Port_t Port, GPIO_Pin_t PinNumber);
+
+
+#endif // SERVICES_INPUTSNAPSHOT_INPUTSNAPSHOT_H_
@@ -0,0 +1,31 @@
+/**
+ * @file InputSnapshot_cfg.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Configuration of the GPIO input snapshot service
+ * @version 0.1
+ * @date 2024-04-10
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef SERVICES_INPUTSNAPSHOT_INPUTSNAPSHOT_CFG_H_
+#define SERVICES_INPUTSNAPSHOT_INPUTSNAPSHOT_CFG_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "MCAL/GPIO/GPIO.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Ports sampled at every tick, bit n enables the port whose @ref GPIO_Port_t value is n.
+ * 
+ * Every port holding a pin read through the snapshot must be listed, the Switches pins included.
+ */
+#define INPUTSNAPSHOT_PORTS_MASK ((1UL << GPIO_GPIOA))
+
+
+#endif // SERVICES_INPUTSNAPSHOT_INPUTSNAPSHOT_CFG_H_
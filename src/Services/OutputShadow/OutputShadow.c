@@ -0,0 +1,51 @@
+/**
+ * @file OutputShadow.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Implementation of the GPIO output shadow service
+ * @version 0.1
+ * @date 2024-04-10
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "OutputShadow.h"
+#include "Services/Scheduler/Scheduler.h"
+#include <string.h>
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+OutputShadow_Port_t OutputShadow_Ports[OUTPUTSHADOW_NUM_OF_PORTS];
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+OutputShadow_Error_t OutputShadow_init(void)
+{
+    memset(OutputShadow_Ports, 0, sizeof(OutputShadow_Ports));
+    Sched_setTickEndHook(OutputShadow_commit);
+
+    return OUTPUTSHADOW_OK;
+}
+
+void OutputShadow_commit(void)
+{
+    uint32_t Port;
+
+    for(Port = 0; Port < OUTPUTSHADOW_NUM_OF_PORTS; Port++)
+    {
+        OutputShadow_Port_t *Shadow = &OutputShadow_Ports[Port];
+
+        if(Shadow->Set | Shadow->Reset)
+        {
+            GPIO_setResetPins((GPIO_Port_t)Port, (uint16_t)Shadow->Set, (uint16_t)Shadow->Reset);
+            Shadow->Set = 0;
+            Shadow->Reset = 0;
+        }
+    }
+}
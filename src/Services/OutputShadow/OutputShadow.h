@@ -0,0 +1,122 @@
+/**
+ * @file OutputShadow.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Header file for the GPIO output shadow service
+ * @version 0.1
+ * @date 2024-04-10
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * Output writes update a per-port shadow and the masks of the pins to set and reset. At the end of
+ * each scheduler tick, every port with pending changes gets one BSRR store. The writes of all the
+ * runnables of a tick are combined, and pins of the same port change at the same time.
+ */
+#ifndef SERVICES_OUTPUTSHADOW_OUTPUTSHADOW_H_
+#define SERVICES_OUTPUTSHADOW_OUTPUTSHADOW_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "OutputShadow_cfg.h"
+#include "MCAL/GPIO/GPIO.h"
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define OUTPUTSHADOW_NUM_OF_PORTS ((uint32_t)GPIO_GPIOH + 1UL)
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Enumeration for the output shadow errors.
+ */
+typedef enum
+{
+    OUTPUTSHADOW_OK,      /**< Operation successful */
+    OUTPUTSHADOW_NOK      /**< Operation not successful */
+} OutputShadow_Error_t;
+
+/**
+ * @brief Shadow of the output pins of a port.
+ */
+typedef struct
+{
+    uint32_t Value;     /**< Levels of the pins written through the shadow, committed or not. */
+    uint32_t Set;       /**< Pins to drive high at the next commit. */
+    uint32_t Reset;     /**< Pins to drive low at the next commit. */
+} OutputShadow_Port_t;
+
+/**
+ * @brief Shadow of each port, indexed by @ref GPIO_Port_t, only accessed through the functions below.
+ */
+extern OutputShadow_Port_t OutputShadow_Ports[OUTPUTSHADOW_NUM_OF_PORTS];
+
+
+/********************************************************************************************************/
+/************************************************APIs****************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Clears the shadow and installs the commit as the scheduler tick end hook.
+ * 
+ * @return OutputShadow_Error_t Error status after initialization.
+ */
+OutputShadow_Error_t OutputShadow_init(void);
+
+/**
+ * @brief Writes the pending changes of every port, one BSRR store per port with changes.
+ * 
+ * Called by the scheduler at the end of every tick, it can also be called directly to apply
+ * the changes immediately.
+ * @note Not interrupt safe, the shadow must only be written from runnables.
+ */
+void OutputShadow_commit(void);
+
+/**
+ * @brief Writes pins of a port in the shadow, they are driven at the next commit.
+ * 
+ * Inline so that constant arguments reduce it to a few operations on the shadow of the port.
+ * 
+ * @param Port The GPIO port.
+ * @param PinsMask Pins to write, bit n is pin n.
+ * @param PinsLevels Levels of the pins, bits outside PinsMask are ignored.
+ */
+static inline void OutputShadow_writePins(GPIO_Port_t Port, uint32_t PinsMask, uint32_t PinsLevels)
+{
+    OutputShadow_Port_t *Shadow = &OutputShadow_Ports[Port];
+    uint32_t Levels = PinsLevels & PinsMask;
+
+    /* The last write of a pin in the tick wins */
+    Shadow->Value = (Shadow->Value & ~PinsMask) | Levels;
+    Shadow->Set   = (Shadow->Set & ~PinsMask) | Levels;
+    Shadow->Reset = (Shadow->Reset & ~PinsMask) | (PinsMask ^ Levels);
+}
+
+/**
+ * @brief Inverts pins of a port in the shadow, from their last written levels.
+ * 
+ * @param Port The GPIO port.
+ * @param PinsMask Pins to invert, bit n is pin n.
+ */
+static inline void OutputShadow_togglePins(GPIO_Port_t Port, uint32_t PinsMask)
+{
+    OutputShadow_writePins(Port, PinsMask, ~OutputShadow_Ports[Port].Value);
+}
+
+/**
+ * @brief Retrieves the last written levels of the pins of a port, committed or not.
+ * 
+ * @param Port The GPIO port.
+ * @return The levels, bit n is pin n, pins never written through the shadow read as 0.
+ */
+static inline uint32_t OutputShadow_getPins(GPIO_Port_t Port)
+{
+    return OutputShadow_Ports[Port].Value;
+}
+
+
+#endif // SERVICES_OUTPUTSHADOW_OUTPUTSHADOW_H_
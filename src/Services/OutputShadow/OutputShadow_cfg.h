@@ -0,0 +1,28 @@
+/**
+ * @file OutputShadow_cfg.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Configuration of the GPIO output shadow service
+ * @version 0.1
+ * @date 2024-04-10
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+#ifndef SERVICES_OUTPUTSHADOW_OUTPUTSHADOW_CFG_H_
+#define SERVICES_OUTPUTSHADOW_OUTPUTSHADOW_CFG_H_
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Routes the writes of the output HAL modules (LEDs) through the output shadow.
+ * 
+ * When enabled, the pins written during a tick change together at the end of the tick, with one
+ * BSRR store per port. Each change is delayed by up to one scheduler tick.
+ * Set to 0 to write the pins immediately.
+ */
+#define OUTPUTSHADOW_ENABLED 0
+
+
+#endif // SERVICES_OUTPUTSHADOW_OUTPUTSHADOW_CFG_H_
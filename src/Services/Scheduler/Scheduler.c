@@ -15,6 +15,17 @@
 #include "Scheduler.h"
 #include "Scheduler_cfg.h"
 #include "MCAL/SysTick/SysTick.h"
+#include "MCAL/stm32f401.h"
+#include "assertparam.h"
+#include <stddef.h>
+
+#if SCHED_PROFILING_ENABLED
+#include "MCAL/DWT/DWT.h"
+#endif
+
+#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE
+#include "Scheduler_table.h"
+#endif
 
 /********************************************************************************************************/
 /************************************************Defines*************************************************/
@@ -25,12 +36,64 @@
  */
 #define SCHED_TICK_TIMEMS 1
 
+/**
+ * @brief Total number of runnable slots, static ones followed by the dynamic pool.
+ */
+#define SCHED_MAX_RUNNABLES (_NUM_OF_RUNNABLES + SCHED_MAX_DYNAMIC_RUNNABLES)
+
+/**
+ * @brief The timer heap is used by the heap mode and as the fallback of the table mode.
+ */
+#define SCHED_USES_HEAP ((SCHED_DISPATCH_MODE == SCHED_DISPATCH_HEAP) || (SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE))
+
+/**
+ * @brief Number of 32-bit words needed to hold one signal flag per runnable slot.
+ */
+#define SCHED_SIGNAL_WORDS ((SCHED_MAX_RUNNABLES + 31) / 32)
+
+/**
+ * @brief Checks whether the absolute time @p Due has been reached at time @p Now.
+ * 
+ * The subtraction is done in unsigned arithmetic so the comparison stays valid
+ * when the millisecond counter wraps around.
+ */
+#define IS_TIME_REACHED(Due, Now) ((int32_t)((uint32_t)(Now) - (uint32_t)(Due)) >= 0)
+
+/**
+ * @brief Effective period of a runnable, a zero periodicity runs it every tick.
+ */
+#define EFFECTIVE_PERIODMS(Period) ((Period) ? (Period) : SCHED_TICK_TIMEMS)
+
+/************************************/
+/***************Validators***********/
+/************************************/
+
+/**
+ * @brief Validate a runnable ID.
+ */
+#define IS_SCHED_RUNNABLE_ID(ID) ((ID) < SCHED_MAX_RUNNABLES)
+
+/**
+ * @brief Validate Sched_OverrunPolicy_t enum values.
+ */
+#define IS_SCHED_OVERRUN_POLICY(POLICY) (((POLICY) == SCHED_OVERRUN_CATCHUP) || \
+                                         ((POLICY) == SCHED_OVERRUN_SKIP)    || \
+                                         ((POLICY) == SCHED_OVERRUN_COALESCE))
 
 
 /********************************************************************************************************/
 /************************************************Types***************************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief Enumeration of the runnable slot states.
+ */
+typedef enum
+{
+    SCHED_STATE_FREE,       /**< Slot holds no runnable */
+    SCHED_STATE_READY,      /**< Runnable is registered and waiting for its due time */
+    SCHED_STATE_SUSPENDED,  /**< Runnable is registered but only runs again once resumed or signaled */
+} RunnableState_t;
 
 /**
  * @brief Structure to hold information about a scheduled runnable task.
@@ -38,9 +101,31 @@
 typedef struct
 {
     Sched_Runnable_Config_t *Runnable;  /**< Pointer to the configuration of the scheduled task */
-    int64_t RemainingTimeMS;           /**< Remaining time until the task's next execution */
+    uint32_t DueTimeMS;                 /**< Absolute scheduler time of the task's next execution */
+    RunnableState_t State;              /**< State of the runnable slot */
+    uint32_t IsDeferred;                /**< Set when the running callback chose its own next due time */
+    Sched_RunnableLateness_t Lateness;  /**< Start time deviation of the task from its due time */
+#if SCHED_USES_HEAP
+    uint32_t HeapIndex;                 /**< Position of the task inside TimerHeap */
+#else
+    uint32_t ActiveIndex;               /**< Position of the task inside ActiveList */
+#endif
 } RunnableInfo_t;
 
+#if SCHED_PROFILING_ENABLED
+/**
+ * @brief Structure to accumulate the execution time of a runnable.
+ */
+typedef struct
+{
+    uint32_t InvocationCount;   /**< Number of recorded executions */
+    uint32_t LastCycles;        /**< Duration of the last execution */
+    uint32_t MinCycles;         /**< Shortest execution */
+    uint32_t MaxCycles;         /**< Longest execution */
+    uint64_t TotalCycles;       /**< Sum of all the recorded durations */
+} RunnableProfile_t;
+#endif
+
 
 
 
@@ -57,16 +142,139 @@ typedef struct
 extern Sched_Runnable_Config_t Sched_Runnables[_NUM_OF_RUNNABLES];
 
 /**
- * @brief Variable to track the number of pending ticks.
+ * @brief Free-running count of the elapsed scheduler ticks.
+ * 
+ * Only the SysTick callback writes it, the main loop compares it against the ticks it has
+ * already processed, so no read-modify-write is shared with the interrupt.
+ * In tickless mode the main loop counts the ticks itself, from the time elapsed since the
+ * last accounted tick boundary, with the interrupts masked.
+ */
+static volatile uint32_t TickCount;
+
+#if SCHED_TICKLESS_ENABLED
+/**
+ * @brief Number of ticks between the last accounted tick boundary and the programmed SysTick expiry.
  * 
  */
-static uint32_t PendingTicks = 1;
+static uint32_t SleepTicks = 1;
+#endif
 
 /**
  * @brief Array to store runtime information for each runnable task.
  * 
+ * Indexes below _NUM_OF_RUNNABLES map to Sched_Runnables, the rest to DynamicRunnables.
+ */
+static RunnableInfo_t rinfo[SCHED_MAX_RUNNABLES];
+
+/**
+ * @brief Storage for the configurations of runnables registered at runtime.
+ * 
+ */
+static Sched_Runnable_Config_t DynamicRunnables[SCHED_MAX_DYNAMIC_RUNNABLES];
+
+/**
+ * @brief Stack of the free dynamic runnable indexes.
+ * 
+ */
+static uint32_t FreeSlots[SCHED_MAX_DYNAMIC_RUNNABLES];
+
+/**
+ * @brief Number of indexes stored in FreeSlots.
+ * 
+ */
+static uint32_t FreeSlotsCount;
+
+/**
+ * @brief One flag per runnable slot, set by Sched_signal() and consumed by the main loop.
+ * 
+ */
+static volatile uint32_t SignalFlags[SCHED_SIGNAL_WORDS];
+
+/**
+ * @brief Index of the runnable whose callback is being executed.
+ * 
+ */
+static uint32_t RunningIdx = SCHED_NO_RUNNABLE;
+
+/**
+ * @brief Function called at the start of every processed tick, before any runnable.
+ * 
+ */
+static Sched_Runnable_Callback_t TickHook = NULL;
+
+/**
+ * @brief Function called at the end of every processed tick, after the last runnable.
+ * 
+ */
+static Sched_Runnable_Callback_t TickEndHook = NULL;
+
+#if SCHED_PROFILING_ENABLED
+/**
+ * @brief Array to store the execution time statistics of each runnable.
+ * 
+ */
+static RunnableProfile_t Profiles[SCHED_MAX_RUNNABLES];
+#endif
+
+/**
+ * @brief Current scheduler time in milliseconds.
+ * 
  */
-static RunnableInfo_t rinfo[_NUM_OF_RUNNABLES];
+static uint32_t SchedTimeMS;
+
+#if SCHED_USES_HEAP
+/**
+ * @brief Min-heap of runnable indexes ordered by their due time.
+ * 
+ * Ties are broken by the runnable index so runnables due on the same tick
+ * execute in the same order as in Sched_Runnables.
+ */
+static uint32_t TimerHeap[SCHED_MAX_RUNNABLES];
+
+/**
+ * @brief Number of runnables currently stored in TimerHeap.
+ * 
+ */
+static uint32_t HeapSize;
+#else
+/**
+ * @brief Dense list of the registered runnable indexes scanned on every tick, sorted by index.
+ * 
+ */
+static uint32_t ActiveList[SCHED_MAX_RUNNABLES];
+
+/**
+ * @brief Number of runnables currently stored in ActiveList.
+ * 
+ */
+static uint32_t ActiveCount;
+#endif
+
+#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE
+/**
+ * @brief Set while the static runnables are dispatched from Sched_Table instead of the heap.
+ * 
+ */
+static uint32_t TableActive;
+
+/**
+ * @brief Slot of Sched_Table for the tick at TableTimeMS.
+ * 
+ */
+static uint32_t TableSlot;
+
+/**
+ * @brief Scheduler time of the next slot to dispatch.
+ * 
+ */
+static uint32_t TableTimeMS;
+
+/**
+ * @brief Position in Sched_Table.Calls of the runnable being executed, SCHED_NO_RUNNABLE outside a slot.
+ * 
+ */
+static uint32_t TableCall = SCHED_NO_RUNNABLE;
+#endif
 
 
 
@@ -78,38 +286,617 @@ static RunnableInfo_t rinfo[_NUM_OF_RUNNABLES];
  * @brief Callback function invoked by the SysTick timer interrupt.
  * 
  * This function is registered as the callback function for the SysTick timer interrupt.
- * It increments the `PendingTicks` variable, indicating that a tick has occurred.
+ * It increments the `TickCount` variable, in tickless mode the expiry only wakes the core up.
  */
 static void TickCallBack(void)
 {
-	PendingTicks++;
+#if !SCHED_TICKLESS_ENABLED
+    TickCount++;
+#endif
+}
+
+#if SCHED_USES_HEAP
+/**
+ * @brief Checks whether runnable @p First must run before runnable @p Second.
+ */
+static uint32_t HeapIsBefore(uint32_t First, uint32_t Second)
+{
+    int32_t diff = (int32_t)(rinfo[First].DueTimeMS - rinfo[Second].DueTimeMS);
+    return (diff < 0) || ((diff == 0) && (First < Second));
+}
+
+/**
+ * @brief Stores runnable @p idx at position @p Pos of TimerHeap.
+ */
+static void HeapPlace(uint32_t Pos, uint32_t idx)
+{
+    TimerHeap[Pos] = idx;
+    rinfo[idx].HeapIndex = Pos;
+}
+
+/**
+ * @brief Moves the heap entry at @p Pos towards the root until the heap order is restored.
+ */
+static void HeapSiftUp(uint32_t Pos)
+{
+    uint32_t idx = TimerHeap[Pos];
+    while(Pos > 0)
+    {
+        uint32_t Parent = (Pos - 1) / 2;
+        if(!HeapIsBefore(idx, TimerHeap[Parent]))
+        {
+            break;
+        }
+        HeapPlace(Pos, TimerHeap[Parent]);
+        Pos = Parent;
+    }
+    HeapPlace(Pos, idx);
+}
+
+/**
+ * @brief Moves the heap entry at @p Pos towards the leaves until the heap order is restored.
+ */
+static void HeapSiftDown(uint32_t Pos)
+{
+    uint32_t idx = TimerHeap[Pos];
+    while(1)
+    {
+        uint32_t Child = (2 * Pos) + 1;
+        if(Child >= HeapSize)
+        {
+            break;
+        }
+        if(((Child + 1) < HeapSize) && HeapIsBefore(TimerHeap[Child + 1], TimerHeap[Child]))
+        {
+            Child++;
+        }
+        if(!HeapIsBefore(TimerHeap[Child], idx))
+        {
+            break;
+        }
+        HeapPlace(Pos, TimerHeap[Child]);
+        Pos = Child;
+    }
+    HeapPlace(Pos, idx);
+}
+
+/**
+ * @brief Restores the heap order around a runnable whose due time has changed.
+ */
+static void HeapUpdate(uint32_t idx)
+{
+    uint32_t Pos = rinfo[idx].HeapIndex;
+    HeapSiftUp(Pos);
+    HeapSiftDown(rinfo[idx].HeapIndex);
+}
+#endif
+
+/**
+ * @brief Adds a runnable to the set of runnables checked by the dispatcher.
+ */
+static void QueueInsert(uint32_t idx)
+{
+#if SCHED_USES_HEAP
+    HeapPlace(HeapSize, idx);
+    HeapSize++;
+    HeapSiftUp(HeapSize - 1);
+#else
+    /* Kept sorted by index, so runnables due on the same tick are dispatched in the heap mode order */
+    uint32_t Pos = ActiveCount;
+    while((Pos > 0) && (ActiveList[Pos - 1] > idx))
+    {
+        ActiveList[Pos] = ActiveList[Pos - 1];
+        rinfo[ActiveList[Pos]].ActiveIndex = Pos;
+        Pos--;
+    }
+    ActiveList[Pos] = idx;
+    rinfo[idx].ActiveIndex = Pos;
+    ActiveCount++;
+#endif
+}
+
+/**
+ * @brief Removes a runnable from the set of runnables checked by the dispatcher.
+ */
+static void QueueRemove(uint32_t idx)
+{
+#if SCHED_USES_HEAP
+    uint32_t Pos = rinfo[idx].HeapIndex;
+    HeapSize--;
+    if(Pos != HeapSize)
+    {
+        /* Fill the hole with the last entry and restore the order around it */
+        HeapPlace(Pos, TimerHeap[HeapSize]);
+        HeapUpdate(TimerHeap[Pos]);
+    }
+#else
+    uint32_t Pos = rinfo[idx].ActiveIndex;
+    ActiveCount--;
+    for(; Pos < ActiveCount; Pos++)
+    {
+        ActiveList[Pos] = ActiveList[Pos + 1];
+        rinfo[ActiveList[Pos]].ActiveIndex = Pos;
+    }
+#endif
+}
+
+/**
+ * @brief Notifies the dispatcher that the due time of a queued runnable has changed.
+ */
+static void QueueUpdate(uint32_t idx)
+{
+#if SCHED_USES_HEAP
+    HeapUpdate(idx);
+#else
+    (void)idx;
+#endif
+}
+
+/**
+ * @brief Returns a dynamic runnable slot to the pool.
+ */
+static void ReleaseSlot(uint32_t idx)
+{
+    if(idx >= _NUM_OF_RUNNABLES)
+    {
+        FreeSlots[FreeSlotsCount] = idx;
+        FreeSlotsCount++;
+    }
+}
+
+#if SCHED_PROFILING_ENABLED
+/**
+ * @brief Clears the execution time statistics of a runnable.
+ */
+static void ProfileReset(uint32_t idx)
+{
+    Profiles[idx].InvocationCount = 0;
+    Profiles[idx].LastCycles = 0;
+    Profiles[idx].MinCycles = UINT32_MAX;
+    Profiles[idx].MaxCycles = 0;
+    Profiles[idx].TotalCycles = 0;
+}
+
+/**
+ * @brief Accounts one execution of @p Cycles in the statistics of a runnable.
+ */
+static void ProfileRecord(uint32_t idx, uint32_t Cycles)
+{
+    RunnableProfile_t *Profile = &Profiles[idx];
+
+    Profile->InvocationCount++;
+    Profile->LastCycles = Cycles;
+    Profile->TotalCycles += Cycles;
+    if(Cycles < Profile->MinCycles)
+    {
+        Profile->MinCycles = Cycles;
+    }
+    if(Cycles > Profile->MaxCycles)
+    {
+        Profile->MaxCycles = Cycles;
+    }
+}
+#endif
+
+/**
+ * @brief Clears the lateness records of a runnable.
+ */
+static void LatenessReset(uint32_t idx)
+{
+    rinfo[idx].Lateness.LastLatenessMS = 0;
+    rinfo[idx].Lateness.MaxLatenessMS = 0;
+    rinfo[idx].Lateness.MissedActivations = 0;
+}
+
+/**
+ * @brief Computes the next due time of a runnable that started @p LatenessMS after its due time.
+ * 
+ * The runnable overrun policy decides what happens to the activations that were missed
+ * while it was late.
+ */
+static void ScheduleNext(uint32_t idx, uint32_t LatenessMS)
+{
+    RunnableInfo_t *Info = &rinfo[idx];
+    uint32_t PeriodMS = EFFECTIVE_PERIODMS(Info->Runnable->PeriodicityMS);
+    uint32_t MissedActivations = LatenessMS / PeriodMS;
+
+    switch(Info->Runnable->OverrunPolicy)
+    {
+        case SCHED_OVERRUN_SKIP:
+        {
+            /* Next point of the original period grid after the current time */
+            Info->DueTimeMS += PeriodMS * (MissedActivations + 1);
+            Info->Lateness.MissedActivations += MissedActivations;
+            break;
+        }
+        case SCHED_OVERRUN_COALESCE:
+        {
+            Info->DueTimeMS = SchedTimeMS + PeriodMS;
+            Info->Lateness.MissedActivations += MissedActivations;
+            break;
+        }
+        case SCHED_OVERRUN_CATCHUP:
+        default:
+        {
+            /* Still due if activations were missed, so the dispatcher runs it again before moving on */
+            Info->DueTimeMS += PeriodMS;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Executes the callback of a due runnable.
+ * 
+ * @return The lateness of the runnable in milliseconds.
+ */
+static uint32_t Execute(uint32_t idx)
+{
+    uint32_t LatenessMS = SchedTimeMS - rinfo[idx].DueTimeMS;
+    rinfo[idx].Lateness.LastLatenessMS = LatenessMS;
+    if(LatenessMS > rinfo[idx].Lateness.MaxLatenessMS)
+    {
+        rinfo[idx].Lateness.MaxLatenessMS = LatenessMS;
+    }
+
+    rinfo[idx].IsDeferred = 0;
+    RunningIdx = idx;
+#if SCHED_PROFILING_ENABLED
+    uint32_t StartCycles = DWT_getCycleCount();
+    rinfo[idx].Runnable->CallBack();
+    ProfileRecord(idx, DWT_getCycleCount() - StartCycles);
+#else
+    rinfo[idx].Runnable->CallBack();
+#endif
+    RunningIdx = SCHED_NO_RUNNABLE;
+
+    return LatenessMS;
+}
+
+/**
+ * @brief Computes the next due time of a runnable once its callback has returned.
+ * 
+ * The callback is allowed to unregister its own runnable, change its period or defer
+ * its next activation, the slot is only handed back to the pool at this point.
+ */
+static void Reschedule(uint32_t idx, uint32_t LatenessMS)
+{
+    if(rinfo[idx].State == SCHED_STATE_READY)
+    {
+        if(!rinfo[idx].IsDeferred)
+        {
+            ScheduleNext(idx, LatenessMS);
+        }
+        QueueUpdate(idx);
+    }
+    else if(rinfo[idx].State == SCHED_STATE_FREE)
+    {
+        ReleaseSlot(idx);
+    }
+    else
+    {
+        /* Suspended, it stays out of the queue until resumed or signaled */
+    }
+}
+
+/**
+ * @brief Executes a due runnable and computes its next due time.
+ */
+static void Dispatch(uint32_t idx)
+{
+    Reschedule(idx, Execute(idx));
+}
+
+#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE
+/**
+ * @brief Checks that Sched_Table was generated from the current Sched_Runnables.
+ */
+static uint32_t TableIsUpToDate(void)
+{
+    uint32_t idx;
+
+    if(!Sched_Table.IsValid || (Sched_Table.TickTimeMS != SCHED_TICK_TIMEMS) || (Sched_Table.NumOfRunnables != _NUM_OF_RUNNABLES))
+    {
+        return 0;
+    }
+
+    for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
+    {
+        Sched_TableSignature_t const *Signature = &Sched_Table.Signature[idx];
+        if((Signature->DelayMS != Sched_Runnables[idx].DelayMS) ||
+           (Signature->PeriodicityMS != Sched_Runnables[idx].PeriodicityMS) ||
+           (Signature->OverrunPolicy != Sched_Runnables[idx].OverrunPolicy) ||
+           (Signature->IsScheduled != (Sched_Runnables[idx].CallBack != 0)))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Executes the slots of Sched_Table up to the current tick.
+ * 
+ * Slots skipped while the main loop was late are replayed, like the catch-up overrun policy.
+ * A callback may make the scheduler leave the table, the rest of its slot is then run from the heap.
+ */
+static void TableDispatch(void)
+{
+    while(TableActive && IS_TIME_REACHED(TableTimeMS, SchedTimeMS))
+    {
+        for(TableCall = Sched_Table.SlotStart[TableSlot]; TableCall < Sched_Table.SlotStart[TableSlot + 1]; TableCall++)
+        {
+            uint32_t idx = Sched_Table.Calls[TableCall];
+            uint32_t LatenessMS;
+
+            rinfo[idx].DueTimeMS = TableTimeMS;
+            LatenessMS = Execute(idx);
+            if(!TableActive)
+            {
+                Reschedule(idx, LatenessMS);
+                break;
+            }
+        }
+        TableCall = SCHED_NO_RUNNABLE;
+
+        if(TableActive)
+        {
+            TableTimeMS += SCHED_TICK_TIMEMS;
+            TableSlot = ((TableSlot + 1) == Sched_Table.NumOfSlots) ? Sched_Table.PrologueSlots : (TableSlot + 1);
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Moves the static runnables from Sched_Table to the heap before the timing of @p RunnableID changes.
+ * 
+ * Each runnable gets the due time of its next activation that the table has not executed yet.
+ * The runnable being executed from the table keeps the current slot time and is rescheduled
+ * once its callback returns.
+ */
+static void LeaveTable(uint32_t RunnableID)
+{
+#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE
+    uint32_t idx;
+
+    if(!TableActive || (RunnableID >= _NUM_OF_RUNNABLES) || (rinfo[RunnableID].State == SCHED_STATE_FREE))
+    {
+        return;
+    }
+    TableActive = 0;
+
+    /* Slots are whole ticks since Sched_start(), modulo the hyperperiod once past the prologue */
+    uint32_t SlotTimeMS = TableSlot * SCHED_TICK_TIMEMS;
+    for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
+    {
+        uint32_t PeriodMS = EFFECTIVE_PERIODMS(rinfo[idx].Runnable->PeriodicityMS);
+        uint32_t DelayMS = rinfo[idx].Runnable->DelayMS;
+        uint32_t UntilNextMS;
+
+        if(rinfo[idx].State != SCHED_STATE_READY)
+        {
+            continue;
+        }
+
+        if(SlotTimeMS <= DelayMS)
+        {
+            UntilNextMS = DelayMS - SlotTimeMS;
+        }
+        else
+        {
+            UntilNextMS = (PeriodMS - ((SlotTimeMS - DelayMS) % PeriodMS)) % PeriodMS;
+        }
+        rinfo[idx].DueTimeMS = TableTimeMS + UntilNextMS;
+
+        /* Calls of a slot are sorted by index, the ones before the running runnable are done */
+        if((UntilNextMS == 0) && (TableCall != SCHED_NO_RUNNABLE) && (idx < Sched_Table.Calls[TableCall]))
+        {
+            rinfo[idx].DueTimeMS += PeriodMS;
+        }
+
+        QueueInsert(idx);
+    }
+#else
+    (void)RunnableID;
+#endif
+}
+
+/**
+ * @brief Makes a runnable due on the current tick.
+ * 
+ * A suspended runnable is put back in the queue, a waiting one has its pending
+ * activation brought forward. Free slots are ignored.
+ */
+static void Wake(uint32_t idx)
+{
+    LeaveTable(idx);
+
+    if(rinfo[idx].State == SCHED_STATE_SUSPENDED)
+    {
+        rinfo[idx].DueTimeMS = SchedTimeMS;
+        rinfo[idx].State = SCHED_STATE_READY;
+        QueueInsert(idx);
+    }
+    else if((rinfo[idx].State == SCHED_STATE_READY) && (idx != RunningIdx) && !IS_TIME_REACHED(rinfo[idx].DueTimeMS, SchedTimeMS))
+    {
+        rinfo[idx].DueTimeMS = SchedTimeMS;
+        QueueUpdate(idx);
+    }
+    else
+    {
+        /* Free, running or already due */
+    }
+}
+
+/**
+ * @brief Wakes up every runnable signaled since the last call.
+ */
+static void ProcessSignals(void)
+{
+    uint32_t Word;
+    for(Word = 0; Word < SCHED_SIGNAL_WORDS; Word++)
+    {
+        uint32_t Flags = CPU_ATOMIC_EXCHANGE(&SignalFlags[Word], 0);
+        while(Flags)
+        {
+            uint32_t Bit = (uint32_t)__builtin_ctz(Flags);
+            Flags &= Flags - 1;
+            Wake((Word * 32) + Bit);
+        }
+    }
+}
+
+#if SCHED_TICKLESS_ENABLED
+/**
+ * @brief Adds the whole ticks elapsed since the last accounted tick boundary to TickCount.
+ * 
+ * The boundary is the SysTick reference point, it moves by the ticks accounted so the
+ * fraction of a tick past them is kept. Called with the interrupts masked.
+ */
+static void AccountElapsedTicks(void)
+{
+    uint32_t ElapsedTicks = SysTick_getElapsedTimeMS() / SCHED_TICK_TIMEMS;
+
+    if(ElapsedTicks)
+    {
+        SysTick_advanceReferenceMS(ElapsedTicks * SCHED_TICK_TIMEMS);
+        TickCount += ElapsedTicks;
+    }
+}
+
+/**
+ * @brief Checks whether a runnable has been signaled and is waiting for the main loop.
+ */
+static uint32_t IsSignalPending(void)
+{
+    uint32_t Word;
+    for(Word = 0; Word < SCHED_SIGNAL_WORDS; Word++)
+    {
+        if(SignalFlags[Word])
+        {
+            return 1;
+        }
+    }
+    return 0;
 }
+#endif
 
 /**
  * @brief Scheduler function responsible for task execution.
  * 
- * This function iterates through all the registered runnables and executes
- * the callback function associated with each runnable if the remaining time
- * for the task has elapsed.
+ * In @ref SCHED_DISPATCH_LINEAR mode this function iterates through all the registered
+ * runnables and executes the ones whose due time has been reached.
+ * In @ref SCHED_DISPATCH_HEAP mode only the top of the timer heap is checked, so a tick
+ * where nothing is due costs a single comparison.
+ * In @ref SCHED_DISPATCH_TABLE mode the static runnables come from the precomputed slot
+ * of the tick, the heap only holds the dynamic ones.
+ * The tick hook is called first, then the runnables signaled since the previous tick are woken up.
+ * The tick end hook is called once every due runnable has been executed.
  */
 static void Scheduler(void)
 {
-	uint32_t idx;
-	for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
-	{
+    if(TickHook != NULL)
+    {
+        TickHook();
+    }
+
+    ProcessSignals();
+
+#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE
+    TableDispatch();
+#endif
 
-		if(rinfo[idx].Runnable && rinfo[idx].Runnable->CallBack && rinfo[idx].RemainingTimeMS <= 0)
-		{
+#if SCHED_USES_HEAP
+    while(HeapSize && IS_TIME_REACHED(rinfo[TimerHeap[0]].DueTimeMS, SchedTimeMS))
+    {
+        Dispatch(TimerHeap[0]);
+    }
+#else
+    uint32_t Pos = 0;
+    while(Pos < ActiveCount)
+    {
+        uint32_t idx = ActiveList[Pos];
 
-			rinfo[idx].Runnable->CallBack();
+        /* A catch-up runnable stays due until its missed activations are replayed, as in heap mode */
+        while((Pos < ActiveCount) && (ActiveList[Pos] == idx) && IS_TIME_REACHED(rinfo[idx].DueTimeMS, SchedTimeMS))
+        {
+            Dispatch(idx);
+        }
 
-			rinfo[idx].RemainingTimeMS = rinfo[idx].Runnable->PeriodicityMS;
-		}
+        /* The runnables after a removed one shift down, the next one is then already at Pos */
+        if((Pos < ActiveCount) && (ActiveList[Pos] == idx))
+        {
+            Pos++;
+        }
+    }
+#endif
 
-		rinfo[idx].RemainingTimeMS -= SCHED_TICK_TIMEMS;
+    if(TickEndHook != NULL)
+    {
+        TickEndHook();
+    }
 
-	}    
+    SchedTimeMS += SCHED_TICK_TIMEMS;
 }
+
+#if SCHED_TICKLESS_ENABLED
+/**
+ * @brief Computes how long the scheduler can sleep after the tick that was just dispatched.
+ * 
+ * The returned duration is measured from the last accounted tick boundary and makes the
+ * timer expire on the tick where the earliest runnable is due.
+ */
+static uint32_t NextSleepTimeMS(void)
+{
+    uint32_t MaxSleepMS = SysTick_getMaxTimeMS();
+    uint32_t SleepMS = MaxSleepMS;
+
+#if SCHED_USES_HEAP
+    if(HeapSize)
+    {
+        SleepMS = (rinfo[TimerHeap[0]].DueTimeMS - SchedTimeMS) + SCHED_TICK_TIMEMS;
+    }
+#else
+    uint32_t Pos;
+    for(Pos = 0; Pos < ActiveCount; Pos++)
+    {
+        uint32_t RunnableSleepMS = (rinfo[ActiveList[Pos]].DueTimeMS - SchedTimeMS) + SCHED_TICK_TIMEMS;
+        SleepMS = (RunnableSleepMS < SleepMS) ? RunnableSleepMS : SleepMS;
+    }
+#endif
+
+#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE
+    if(TableActive)
+    {
+        /* Empty slots ahead are slept through, up to the heap deadline */
+        uint32_t Slot = TableSlot;
+        uint32_t TableSleepMS = (TableTimeMS - SchedTimeMS) + SCHED_TICK_TIMEMS;
+        while((TableSleepMS < SleepMS) && (Sched_Table.SlotStart[Slot] == Sched_Table.SlotStart[Slot + 1]))
+        {
+            TableSleepMS += SCHED_TICK_TIMEMS;
+            Slot = ((Slot + 1) == Sched_Table.NumOfSlots) ? Sched_Table.PrologueSlots : (Slot + 1);
+        }
+        SleepMS = (TableSleepMS < SleepMS) ? TableSleepMS : SleepMS;
+    }
+#endif
+
+    /* Sleep whole ticks only, and never past the longest SysTick period */
+    SleepMS -= SleepMS % SCHED_TICK_TIMEMS;
+    if(SleepMS < SCHED_TICK_TIMEMS)
+    {
+        SleepMS = SCHED_TICK_TIMEMS;
+    }
+    else if(SleepMS > MaxSleepMS)
+    {
+        SleepMS = MaxSleepMS - (MaxSleepMS % SCHED_TICK_TIMEMS);
+    }
+
+    return SleepMS;
+}
+#endif
+
 /********************************************************************************************************/
 /*********************************************APIs Implementation****************************************/
 /********************************************************************************************************/
@@ -117,10 +904,10 @@ static void Scheduler(void)
 
 void Sched_init(void)
 {
-    PendingTicks = 0;
+    TickCount = 0;
 
     /* Initializing Systick */
-    SysTick_Config_t config = 
+    SysTick_Config_t config =
     {
         .CallbackFunction = TickCallBack,
         .ClockSource = SYSTICK_CLK_AHB,
@@ -128,26 +915,331 @@ void Sched_init(void)
     };
     SysTick_init(&config);
 
+#if SCHED_PROFILING_ENABLED
+    DWT_init();
+#endif
+
     /* Initializing runnables states */
+    SchedTimeMS = 0;
+#if SCHED_USES_HEAP
+    HeapSize = 0;
+#else
+    ActiveCount = 0;
+#endif
+#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE
+    /* An outdated table is ignored and every runnable goes through the heap */
+    TableActive = TableIsUpToDate();
+    TableSlot = 0;
+    TableTimeMS = 0;
+    TableCall = SCHED_NO_RUNNABLE;
+#endif
     uint32_t idx;
-	for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
+    for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
     {
         rinfo[idx].Runnable = &Sched_Runnables[idx];
-		rinfo[idx].RemainingTimeMS = rinfo[idx].Runnable->DelayMS;
-		      
+        rinfo[idx].DueTimeMS = rinfo[idx].Runnable->DelayMS;
+        rinfo[idx].State = SCHED_STATE_FREE;
+        LatenessReset(idx);
+#if SCHED_PROFILING_ENABLED
+        ProfileReset(idx);
+#endif
+
+        /* Runnables without a callback are never dispatched */
+        if(rinfo[idx].Runnable->CallBack)
+        {
+            assert_param(IS_SCHED_OVERRUN_POLICY(rinfo[idx].Runnable->OverrunPolicy));
+            rinfo[idx].State = SCHED_STATE_READY;
+#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE
+            if(!TableActive)
+#endif
+            {
+                QueueInsert(idx);
+            }
+        }
+    }
+
+    /* Filling the dynamic pool, lowest index is handed out first */
+    FreeSlotsCount = 0;
+    for(idx = SCHED_MAX_RUNNABLES; idx > _NUM_OF_RUNNABLES; idx--)
+    {
+        rinfo[idx - 1].Runnable = &DynamicRunnables[idx - 1 - _NUM_OF_RUNNABLES];
+        rinfo[idx - 1].State = SCHED_STATE_FREE;
+        ReleaseSlot(idx - 1);
     }
 }
 
 
 void Sched_start(void)
 {
+    uint32_t ProcessedTicks = TickCount;
+
     SysTick_startTimerMS(SCHED_TICK_TIMEMS);
-	while(1)
-	{
-		if(PendingTicks)
-		{
-			PendingTicks--;
-			Scheduler();
-		}
-	}
-}
\ No newline at end of file
+    while(1)
+    {
+#if SCHED_TICKLESS_ENABLED
+        /* Interrupts are masked so a tick arriving between the check and WFI still wakes the core */
+        CPU_DISABLE_IRQ();
+        AccountElapsedTicks();
+        while(TickCount == ProcessedTicks)
+        {
+            /* Ticks are accounted up to the reference point, so a signaled runnable waits at most for the next
+             * tick boundary. The cut is measured from the same reference as the sleep it shortens. */
+            if(IsSignalPending() && (SleepTicks > 1))
+            {
+                SleepTicks = 1;
+                SysTick_restartTimerMS(SCHED_TICK_TIMEMS);
+            }
+            CPU_WAIT_FOR_INTERRUPT();
+            CPU_ENABLE_IRQ();
+            CPU_DISABLE_IRQ();
+            AccountElapsedTicks();
+        }
+        CPU_ENABLE_IRQ();
+#endif
+
+        uint32_t ElapsedTicks = TickCount - ProcessedTicks;
+        if(ElapsedTicks)
+        {
+            ProcessedTicks += ElapsedTicks;
+
+            /* Jump to the latest tick, missed activations are handled by each runnable's overrun policy */
+            SchedTimeMS += (ElapsedTicks - 1) * SCHED_TICK_TIMEMS;
+            Scheduler();
+
+#if SCHED_TICKLESS_ENABLED
+            /* Signals raised by the runnables themselves shorten the next sleep */
+            ProcessSignals();
+
+            /* Ticks spent dispatching are accounted, they are dispatched right away instead of sleeping */
+            CPU_DISABLE_IRQ();
+            AccountElapsedTicks();
+            if(TickCount == ProcessedTicks)
+            {
+                SleepTicks = NextSleepTimeMS() / SCHED_TICK_TIMEMS;
+                SysTick_restartTimerMS(SleepTicks * SCHED_TICK_TIMEMS);
+            }
+            CPU_ENABLE_IRQ();
+#endif
+        }
+        else
+        {
+            CPU_IDLE_HOOK();
+        }
+    }
+}
+
+Sched_Error_t Sched_registerRunnable(Sched_Runnable_Config_t const *Config, uint32_t *RunnableID)
+{
+    assert_param(Config);
+    assert_param(Config->CallBack);
+    assert_param(IS_SCHED_OVERRUN_POLICY(Config->OverrunPolicy));
+    assert_param(RunnableID);
+
+    if(FreeSlotsCount == 0)
+    {
+        return SCHED_NOK;
+    }
+
+    FreeSlotsCount--;
+    uint32_t idx = FreeSlots[FreeSlotsCount];
+
+    *rinfo[idx].Runnable = *Config;
+    rinfo[idx].DueTimeMS = SchedTimeMS + Config->DelayMS;
+    rinfo[idx].State = SCHED_STATE_READY;
+    QueueInsert(idx);
+    LatenessReset(idx);
+#if SCHED_PROFILING_ENABLED
+    ProfileReset(idx);
+#endif
+
+    *RunnableID = idx;
+    return SCHED_OK;
+}
+
+Sched_Error_t Sched_unregisterRunnable(uint32_t RunnableID)
+{
+    assert_param(IS_SCHED_RUNNABLE_ID(RunnableID));
+
+    if(!IS_SCHED_RUNNABLE_ID(RunnableID) || (rinfo[RunnableID].State == SCHED_STATE_FREE))
+    {
+        return SCHED_NOK;
+    }
+
+    LeaveTable(RunnableID);
+    if(rinfo[RunnableID].State == SCHED_STATE_READY)
+    {
+        QueueRemove(RunnableID);
+    }
+    rinfo[RunnableID].State = SCHED_STATE_FREE;
+
+    /* A runnable unregistering itself is released once its callback returns */
+    if(RunnableID != RunningIdx)
+    {
+        ReleaseSlot(RunnableID);
+    }
+
+    return SCHED_OK;
+}
+
+Sched_Error_t Sched_setPeriod(uint32_t RunnableID, uint32_t PeriodicityMS)
+{
+    assert_param(IS_SCHED_RUNNABLE_ID(RunnableID));
+
+    if(!IS_SCHED_RUNNABLE_ID(RunnableID) || (rinfo[RunnableID].State == SCHED_STATE_FREE))
+    {
+        return SCHED_NOK;
+    }
+
+    LeaveTable(RunnableID);
+
+    /* The pending activation is moved so it happens one new period after the previous one */
+    if((rinfo[RunnableID].State == SCHED_STATE_READY) && (RunnableID != RunningIdx))
+    {
+        rinfo[RunnableID].DueTimeMS += EFFECTIVE_PERIODMS(PeriodicityMS) - EFFECTIVE_PERIODMS(rinfo[RunnableID].Runnable->PeriodicityMS);
+        QueueUpdate(RunnableID);
+    }
+    rinfo[RunnableID].Runnable->PeriodicityMS = PeriodicityMS;
+
+    return SCHED_OK;
+}
+
+Sched_Error_t Sched_getStats(uint32_t RunnableID, Sched_RunnableStats_t *Stats)
+{
+    assert_param(IS_SCHED_RUNNABLE_ID(RunnableID));
+    assert_param(Stats);
+
+#if SCHED_PROFILING_ENABLED
+    if(!IS_SCHED_RUNNABLE_ID(RunnableID))
+    {
+        return SCHED_NOK;
+    }
+
+    RunnableProfile_t const *Profile = &Profiles[RunnableID];
+
+    Stats->InvocationCount = Profile->InvocationCount;
+    Stats->LastCycles = Profile->LastCycles;
+    Stats->MaxCycles = Profile->MaxCycles;
+    Stats->MinCycles = Profile->InvocationCount ? Profile->MinCycles : 0;
+    Stats->MeanCycles = Profile->InvocationCount ? (uint32_t)(Profile->TotalCycles / Profile->InvocationCount) : 0;
+
+    return SCHED_OK;
+#else
+    (void)RunnableID;
+    (void)Stats;
+    return SCHED_NOK;
+#endif
+}
+
+Sched_Error_t Sched_getLateness(uint32_t RunnableID, Sched_RunnableLateness_t *Lateness)
+{
+    assert_param(IS_SCHED_RUNNABLE_ID(RunnableID));
+    assert_param(Lateness);
+
+    if(!IS_SCHED_RUNNABLE_ID(RunnableID) || (rinfo[RunnableID].State == SCHED_STATE_FREE))
+    {
+        return SCHED_NOK;
+    }
+
+    *Lateness = rinfo[RunnableID].Lateness;
+    return SCHED_OK;
+}
+
+Sched_Error_t Sched_suspend(uint32_t RunnableID)
+{
+    assert_param(IS_SCHED_RUNNABLE_ID(RunnableID));
+
+    if(!IS_SCHED_RUNNABLE_ID(RunnableID) || (rinfo[RunnableID].State != SCHED_STATE_READY))
+    {
+        return SCHED_NOK;
+    }
+
+    LeaveTable(RunnableID);
+    QueueRemove(RunnableID);
+    rinfo[RunnableID].State = SCHED_STATE_SUSPENDED;
+
+    return SCHED_OK;
+}
+
+Sched_Error_t Sched_resume(uint32_t RunnableID)
+{
+    assert_param(IS_SCHED_RUNNABLE_ID(RunnableID));
+
+    if(!IS_SCHED_RUNNABLE_ID(RunnableID) || (rinfo[RunnableID].State != SCHED_STATE_SUSPENDED))
+    {
+        return SCHED_NOK;
+    }
+
+    Wake(RunnableID);
+
+    return SCHED_OK;
+}
+
+void Sched_signal(uint32_t RunnableID)
+{
+    assert_param(IS_SCHED_RUNNABLE_ID(RunnableID));
+
+    if(IS_SCHED_RUNNABLE_ID(RunnableID))
+    {
+        CPU_ATOMIC_OR(&SignalFlags[RunnableID / 32], 1UL << (RunnableID % 32));
+    }
+}
+
+Sched_Error_t Sched_sleep(uint32_t RunnableID, uint32_t TimeMS)
+{
+    assert_param(IS_SCHED_RUNNABLE_ID(RunnableID));
+
+    if(!IS_SCHED_RUNNABLE_ID(RunnableID) || (rinfo[RunnableID].State == SCHED_STATE_FREE))
+    {
+        return SCHED_NOK;
+    }
+
+    LeaveTable(RunnableID);
+
+    /* The activation is never on the current tick, so a runnable deferring itself can not be re-dispatched in a loop */
+    if(TimeMS < SCHED_TICK_TIMEMS)
+    {
+        TimeMS = SCHED_TICK_TIMEMS;
+    }
+    rinfo[RunnableID].DueTimeMS = SchedTimeMS + TimeMS;
+
+    if(RunnableID == RunningIdx)
+    {
+        rinfo[RunnableID].IsDeferred = 1;
+    }
+
+    if(rinfo[RunnableID].State == SCHED_STATE_SUSPENDED)
+    {
+        rinfo[RunnableID].State = SCHED_STATE_READY;
+        QueueInsert(RunnableID);
+    }
+    else if(RunnableID != RunningIdx)
+    {
+        QueueUpdate(RunnableID);
+    }
+    else
+    {
+        /* Queue position of the running runnable is updated once its callback returns */
+    }
+
+    return SCHED_OK;
+}
+
+uint32_t Sched_getTimeMS(void)
+{
+    return SchedTimeMS;
+}
+
+uint32_t Sched_getRunningID(void)
+{
+    return RunningIdx;
+}
+
+void Sched_setTickHook(Sched_Runnable_Callback_t Hook)
+{
+    TickHook = Hook;
+}
+
+void Sched_setTickEndHook(Sched_Runnable_Callback_t Hook)
+{
+    TickEndHook = Hook;
+}
@@ -28,11 +28,62 @@
  */
 typedef void (*Sched_Runnable_Callback_t)(void);
 
+/**
+ * @brief Dispatch strategy: scan every runnable on each tick (O(N) per tick).
+ * 
+ * The runnables are scanned by index, so the ones with the same due time run in the same
+ * order as with @ref SCHED_DISPATCH_HEAP.
+ */
+#define SCHED_DISPATCH_LINEAR   0
+
+/**
+ * @brief Dispatch strategy: min-heap ordered by absolute due time.
+ * 
+ * A tick where nothing is due costs a single comparison against the heap top,
+ * and only the due runnables are touched.
+ */
+#define SCHED_DISPATCH_HEAP     1
+
+/**
+ * @brief Dispatch strategy: precomputed cyclic-executive table of the static runnables.
+ * 
+ * Each tick costs one table lookup and direct calls of the due runnables. The table is generated
+ * from Scheduler_cfg.c by `make sched-table` into Scheduler_table.c. The scheduler falls back to
+ * @ref SCHED_DISPATCH_HEAP when the table is missing or out of date, and as soon as the timing of
+ * a static runnable is changed at runtime (suspend, signal, sleep, period change, unregistering).
+ * Runnables registered at runtime always use the heap.
+ */
+#define SCHED_DISPATCH_TABLE    2
+
+/**
+ * @brief Marker for "no runnable", returned by Sched_getRunningID() outside a runnable.
+ */
+#define SCHED_NO_RUNNABLE       (0xFFFFFFFFUL)
+
 
 /********************************************************************************************************/
 /************************************************Types***************************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief Enumeration for Scheduler-related errors.
+ */
+typedef enum
+{
+    SCHED_OK,       /**< Operation successful */
+    SCHED_NOK       /**< Operation not successful */
+} Sched_Error_t;
+
+/**
+ * @brief Enumeration of what happens to the activations a runnable misses while it is late.
+ */
+typedef enum
+{
+    SCHED_OVERRUN_CATCHUP,      /**< Every missed activation is executed, back-to-back. */
+    SCHED_OVERRUN_SKIP,         /**< Missed activations are dropped, the runnable keeps its original phase. */
+    SCHED_OVERRUN_COALESCE,     /**< Missed activations are merged into one, the period restarts from it. */
+} Sched_OverrunPolicy_t;
+
 /**
  * @brief Configuration structure for scheduler runnables.
  * 
@@ -44,9 +95,36 @@ typedef struct
 	uint32_t DelayMS;                       /**< Time until the task is first executed. */
 	uint32_t PeriodicityMS;                 /**< Periodicity of the task in milliseconds. */
 	Sched_Runnable_Callback_t CallBack;     /**< Callback function to be executed as the task. */
+	Sched_OverrunPolicy_t OverrunPolicy;    /**< Handling of missed activations, defaults to catching up. */
 } Sched_Runnable_Config_t;
 
 
+/**
+ * @brief Execution time statistics of a runnable.
+ * 
+ * Durations are expressed in DWT cycles (nanoseconds in a HOST_BUILD).
+ */
+typedef struct
+{
+    uint32_t InvocationCount;   /**< Number of times the callback has been executed. */
+    uint32_t LastCycles;        /**< Duration of the last execution. */
+    uint32_t MinCycles;         /**< Shortest execution. */
+    uint32_t MaxCycles;         /**< Longest execution. */
+    uint32_t MeanCycles;        /**< Mean duration over all executions. */
+} Sched_RunnableStats_t;
+
+/**
+ * @brief Deviation of a runnable start time from its due time.
+ * 
+ * The lateness is measured in milliseconds with the resolution of the scheduler tick.
+ */
+typedef struct
+{
+    uint32_t LastLatenessMS;    /**< Lateness of the last execution. */
+    uint32_t MaxLatenessMS;     /**< Worst lateness observed. */
+    uint32_t MissedActivations; /**< Activations dropped or merged by the overrun policy. */
+} Sched_RunnableLateness_t;
+
 /********************************************************************************************************/
 /************************************************APIs****************************************************/
 /********************************************************************************************************/
@@ -66,9 +144,148 @@ void Sched_init(void);
  * This function starts the scheduler, allowing scheduled tasks to be executed.
  * Before calling this function, ensure that the scheduler has been initialized
  * using Sched_init().
+ * @note When SCHED_TICKLESS_ENABLED is set, the CPU sleeps between runnable deadlines
+ * and the SysTick is reprogrammed after every dispatch.
  */
 void Sched_start(void);
 
+/**
+ * @brief Registers a runnable at runtime.
+ * 
+ * The configuration is copied into a fixed-capacity pool of SCHED_MAX_DYNAMIC_RUNNABLES
+ * slots, so @p Config does not need to outlive the call. The first execution happens
+ * DelayMS after the registration.
+ *
+ * Claiming the slot takes constant time, queueing the runnable does not: in SCHED_DISPATCH_HEAP
+ * and SCHED_DISPATCH_TABLE it is a heap insert, O(log N), as the heap must stay ordered by due
+ * time for the dispatcher to find the next runnable at its root. In SCHED_DISPATCH_LINEAR it is
+ * O(N), the active list being kept sorted by index.
+ *
+ * @param[in] Config Configuration of the runnable to register.
+ * @param[out] RunnableID ID of the registered runnable, used by the other Sched APIs.
+ * @return SCHED_OK on success, SCHED_NOK if the pool is full.
+ * @note Must be called after Sched_init(), from main or runnable context.
+ */
+Sched_Error_t Sched_registerRunnable(Sched_Runnable_Config_t const *Config, uint32_t *RunnableID);
+
+/**
+ * @brief Unregisters a runnable so it is no longer executed.
+ * 
+ * Works for both the runnables of Sched_Runnables (using their @ref Sched_Runnable_Name_t)
+ * and the ones registered with Sched_registerRunnable(). A runnable may unregister itself
+ * from its own callback.
+ * 
+ * @param RunnableID ID of the runnable to unregister.
+ * @return SCHED_OK on success, SCHED_NOK if the runnable is not registered.
+ */
+Sched_Error_t Sched_unregisterRunnable(uint32_t RunnableID);
+
+/**
+ * @brief Changes the periodicity of a registered runnable.
+ * 
+ * The pending activation is moved so it happens one new period after the previous one.
+ * 
+ * @param RunnableID ID of the runnable.
+ * @param PeriodicityMS New periodicity in milliseconds.
+ * @return SCHED_OK on success, SCHED_NOK if the runnable is not registered.
+ */
+Sched_Error_t Sched_setPeriod(uint32_t RunnableID, uint32_t PeriodicityMS);
+
+/**
+ * @brief Retrieves the execution time statistics of a runnable.
+ * 
+ * @param RunnableID ID of the runnable.
+ * @param[out] Stats Statistics of the runnable.
+ * @return SCHED_OK on success, SCHED_NOK if SCHED_PROFILING_ENABLED is not set.
+ */
+Sched_Error_t Sched_getStats(uint32_t RunnableID, Sched_RunnableStats_t *Stats);
+
+/**
+ * @brief Retrieves the lateness records of a runnable.
+ * 
+ * @param RunnableID ID of the runnable.
+ * @param[out] Lateness Lateness records of the runnable.
+ * @return SCHED_OK on success, SCHED_NOK if the runnable is not registered.
+ */
+Sched_Error_t Sched_getLateness(uint32_t RunnableID, Sched_RunnableLateness_t *Lateness);
+
+/**
+ * @brief Suspends a runnable, it is no longer executed periodically.
+ * 
+ * A runnable may suspend itself from its own callback, typically once it has no pending work.
+ * 
+ * @param RunnableID ID of the runnable.
+ * @return SCHED_OK on success, SCHED_NOK if the runnable is not registered or already suspended.
+ */
+Sched_Error_t Sched_suspend(uint32_t RunnableID);
+
+/**
+ * @brief Resumes a suspended runnable.
+ * 
+ * The runnable is executed on the next tick, then periodically again.
+ * 
+ * @param RunnableID ID of the runnable.
+ * @return SCHED_OK on success, SCHED_NOK if the runnable is not suspended.
+ * @note Not interrupt safe, use Sched_signal() from interrupt handlers.
+ */
+Sched_Error_t Sched_resume(uint32_t RunnableID);
+
+/**
+ * @brief Signals a runnable that it has pending work.
+ * 
+ * A suspended runnable is resumed and a waiting one has its next activation brought forward,
+ * in both cases it is executed on the next tick. Signals are only latched here and processed
+ * by the scheduler, so this function can be called from drivers and interrupt handlers.
+ * 
+ * @param RunnableID ID of the runnable.
+ */
+void Sched_signal(uint32_t RunnableID);
+
+/**
+ * @brief Defers the next activation of a runnable by @p TimeMS, it then continues with its periodicity.
+ * 
+ * A suspended runnable is resumed once the time elapses, unless it is signaled earlier.
+ * 
+ * @param RunnableID ID of the runnable.
+ * @param TimeMS Time until the next activation in milliseconds, at least one tick.
+ * @return SCHED_OK on success, SCHED_NOK if the runnable is not registered.
+ * @note Not interrupt safe.
+ */
+Sched_Error_t Sched_sleep(uint32_t RunnableID, uint32_t TimeMS);
+
+/**
+ * @brief Retrieves the scheduler time.
+ * 
+ * @return Time of the tick being processed in milliseconds, wraps around every 2^32 ms.
+ */
+uint32_t Sched_getTimeMS(void);
+
+/**
+ * @brief Retrieves the ID of the runnable whose callback is being executed.
+ * 
+ * @return The runnable ID, or SCHED_NO_RUNNABLE when called outside a runnable.
+ */
+uint32_t Sched_getRunningID(void);
+
+/**
+ * @brief Sets the function called at the start of every tick, before any runnable is executed.
+ * 
+ * Used by services that prepare data shared by the runnables of the tick, such as the input snapshot.
+ * A tick where several SysTick periods elapsed calls it once.
+ * 
+ * @param Hook Function to call, NULL to remove the current one.
+ */
+void Sched_setTickHook(Sched_Runnable_Callback_t Hook);
+
+/**
+ * @brief Sets the function called at the end of every tick, once the due runnables have been executed.
+ * 
+ * Used by services that publish the work of the runnables of the tick, such as the output shadow.
+ * 
+ * @param Hook Function to call, NULL to remove the current one.
+ */
+void Sched_setTickEndHook(Sched_Runnable_Callback_t Hook);
+
 
 
 
@@ -20,6 +20,35 @@
 /************************************************Defines*************************************************/
 /********************************************************************************************************/
 
+/**
+ * @brief Dispatch strategy used by the scheduler.
+ * 
+ * Can be @ref SCHED_DISPATCH_LINEAR, @ref SCHED_DISPATCH_HEAP or @ref SCHED_DISPATCH_TABLE.
+ */
+#define SCHED_DISPATCH_MODE SCHED_DISPATCH_HEAP
+
+/**
+ * @brief Enables the tickless idle mode of the scheduler.
+ * 
+ * When enabled, SysTick is programmed to expire at the next runnable deadline instead of
+ * every tick and the CPU sleeps (WFI) in between. Set to 0 to keep the periodic tick.
+ */
+#define SCHED_TICKLESS_ENABLED 0
+
+/**
+ * @brief Number of runnables that can be registered at runtime with Sched_registerRunnable().
+ */
+#define SCHED_MAX_DYNAMIC_RUNNABLES 4
+
+/**
+ * @brief Enables the per-runnable execution time profiling based on the DWT cycle counter.
+ * 
+ * When set to 0 the profiling code is not compiled and Sched_getStats() returns SCHED_NOK.
+ * Can be set from the command line, the host statistics test builds the scheduler with it enabled.
+ */
+#ifndef SCHED_PROFILING_ENABLED
+#define SCHED_PROFILING_ENABLED 0
+#endif
 
 
 /********************************************************************************************************/
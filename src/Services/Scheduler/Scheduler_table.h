@@ -0,0 +1,65 @@
+/**
+ * @file Scheduler_table.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Layout of the precomputed dispatch table used in SCHED_DISPATCH_TABLE mode.
+ * @version 0.1
+ * @date 2024-04-05
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ * The table itself lives in Scheduler_table.c, which is generated from Scheduler_cfg.c
+ * by tools/SchedTableGen (`make sched-table`).
+ */
+#ifndef SERVICES_SCHEDULER_SCHEDULER_TABLE_H_
+#define SERVICES_SCHEDULER_SCHEDULER_TABLE_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "Scheduler.h"
+#include "Scheduler_cfg.h"
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Timing of a runnable of Sched_Runnables as it was when the table was generated.
+ */
+typedef struct
+{
+    uint32_t DelayMS;                       /**< DelayMS of the runnable */
+    uint32_t PeriodicityMS;                 /**< PeriodicityMS of the runnable */
+    Sched_OverrunPolicy_t OverrunPolicy;    /**< OverrunPolicy of the runnable */
+    uint32_t IsScheduled;                   /**< 1 if the runnable has a callback */
+} Sched_TableSignature_t;
+
+/**
+ * @brief Cyclic-executive dispatch table.
+ * 
+ * Slot n holds the runnables due on tick n, stored as indexes in Sched_Runnables from
+ * Calls[SlotStart[n]] to Calls[SlotStart[n + 1] - 1]. The slots before PrologueSlots cover
+ * the first activations (DelayMS), the remaining ones repeat forever and span one hyperperiod.
+ */
+typedef struct
+{
+    uint32_t IsValid;                           /**< 0 if the configuration could not be tabulated */
+    uint32_t TickTimeMS;                        /**< Tick duration the table was generated for */
+    uint32_t NumOfRunnables;                    /**< Size of Signature */
+    Sched_TableSignature_t const *Signature;    /**< Timing of every runnable of Sched_Runnables */
+    uint32_t PrologueSlots;                     /**< Number of slots played only once */
+    uint32_t NumOfSlots;                        /**< Prologue slots plus one hyperperiod */
+    uint16_t const *SlotStart;                  /**< First call of each slot, NumOfSlots + 1 entries */
+    uint8_t const *Calls;                       /**< Runnable indexes of all the slots */
+} Sched_Table_t;
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+extern const Sched_Table_t Sched_Table;
+
+
+#endif // SERVICES_SCHEDULER_SCHEDULER_TABLE_H_
@@ -35,10 +35,10 @@ void ToggleYellowLed1MS(void)
 }
 #include "MCAL/GPIO/GPIO.h"
 #include "HAL/LCD/LCD.h"
+#include "HAL/Board/Board.h"
 int main()
 {
-    RCC_enableAHB1Peripheral(RCC_AHB1PERIPHERAL_GPIOA);
-    RCC_enableAHB1Peripheral(RCC_AHB1PERIPHERAL_GPIOB);
+    Board_init();
 
 
 
@@ -0,0 +1,245 @@
+/**
+ * @file GpioBench.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Compares the GPIO pin handles of GPIO_Pin.h against the GPIO/LED/Switch functions, the
+ *        read-modify-write, BSRR and bit-band paths of single-bit register accesses, and the access
+ *        methods of the pin groups driving a byte-wide bus.
+ * @version 0.1
+ * @date 2024-04-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Runs on the simulated register backend (host/Sim). For each operation it reports the host
+ * instructions executed and the register accesses made by one call, both paths being built with
+ * the same compiler options and with assert_param enabled as on the target.
+ *
+ * Usage: GpioBench
+ */
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdio.h>
+#include "Sim/Sim.h"
+#include "MCAL/GPIO/GPIO.h"
+#include "MCAL/GPIO/GPIO_Pin.h"
+#include "MCAL/GPIO/GPIO_Reg.h"
+#include "MCAL/stm32f401.h"
+#include "HAL/Led/Led.h"
+#include "HAL/Switch/Switch.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define NUM_OF_RUNS 5UL
+
+#define BUS_WIDTH   8UL
+
+#define GPIOA_REGS      ((GPIO_TypeDef volatile *)GPIOA_BASE)
+#define RCC_CR_ADDRESS  (0x40023800UL)
+#define RCC_CR          (*(uint32_t volatile *)RCC_CR_ADDRESS)
+#define SYSTICK_CTRL    (*(uint32_t volatile *)0xE000E010UL)
+
+/**
+ * @brief Measures one execution of @p Code, keeping the fastest of NUM_OF_RUNS runs.
+ */
+#define MEASURE(Result, Periph, Code)                                               \
+    do                                                                          \
+    {                                                                           \
+        uint32_t Run;                                                           \
+        (Result)->Instructions = UINT64_MAX;                                    \
+        for(Run = 0; Run < NUM_OF_RUNS; Run++)                                  \
+        {                                                                       \
+            uint64_t Count;                                                     \
+            Sim_resetAccessCounts();                                            \
+            Sim_startInstructionCount();                                        \
+            Code;                                                               \
+            Count = Sim_stopInstructionCount();                                 \
+            (Result)->Instructions = (Count < (Result)->Instructions) ? Count : (Result)->Instructions; \
+        }                                                                       \
+        Sim_getAccessCount((Periph), &(Result)->Accesses);                      \
+    } while(0)
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+typedef struct
+{
+    uint64_t Instructions;
+    Sim_AccessCount_t Accesses;
+} Result_t;
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+static volatile uint32_t Sink;
+static uint64_t Overhead;
+
+/* Contiguous (the LCD data bus), scattered and two-port byte-wide buses */
+static const GPIO_PinID_t FieldPins[BUS_WIDTH] =
+{
+    {GPIO_GPIOA, GPIO_PIN2}, {GPIO_GPIOA, GPIO_PIN3}, {GPIO_GPIOA, GPIO_PIN4}, {GPIO_GPIOA, GPIO_PIN5},
+    {GPIO_GPIOA, GPIO_PIN6}, {GPIO_GPIOA, GPIO_PIN7}, {GPIO_GPIOA, GPIO_PIN8}, {GPIO_GPIOA, GPIO_PIN9},
+};
+static const GPIO_PinID_t ScatteredPins[BUS_WIDTH] =
+{
+    {GPIO_GPIOA, GPIO_PIN9}, {GPIO_GPIOA, GPIO_PIN2}, {GPIO_GPIOA, GPIO_PIN7}, {GPIO_GPIOA, GPIO_PIN4},
+    {GPIO_GPIOA, GPIO_PIN12}, {GPIO_GPIOA, GPIO_PIN5}, {GPIO_GPIOA, GPIO_PIN0}, {GPIO_GPIOA, GPIO_PIN15},
+};
+static const GPIO_PinID_t TwoPortPins[BUS_WIDTH] =
+{
+    {GPIO_GPIOA, GPIO_PIN2}, {GPIO_GPIOA, GPIO_PIN3}, {GPIO_GPIOA, GPIO_PIN4}, {GPIO_GPIOA, GPIO_PIN5},
+    {GPIO_GPIOB, GPIO_PIN0}, {GPIO_GPIOB, GPIO_PIN1}, {GPIO_GPIOB, GPIO_PIN2}, {GPIO_GPIOB, GPIO_PIN3},
+};
+static GPIO_PinGroup_t FieldGroup;
+static GPIO_PinGroup_t ScatteredGroup;
+static uint32_t ScatteredLut[GPIO_PINGROUP_LUT_SIZE(BUS_WIDTH)];
+static GPIO_PinGroup_t TwoPortGroup;
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static void Report(const char *Operation, Result_t const *Function, Result_t const *Handle);
+static void ReportPath(const char *Operation, const char *Path, Result_t const *Result);
+static void WriteBusPinByPin(GPIO_PinID_t const *Pins, uint32_t Value);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+void assert_failed(uint8_t *file, uint32_t line)
+{
+    fprintf(stderr, "assert failed: %s:%lu\n", (const char *)file, (unsigned long)line);
+}
+
+static void Report(const char *Operation, Result_t const *Function, Result_t const *Handle)
+{
+    uint64_t FunctionCost = Function->Instructions - Overhead;
+    uint64_t HandleCost = Handle->Instructions - Overhead;
+
+    printf("%-22s %8llu %4llu/%-4llu %8llu %4llu/%-4llu %7.1fx\n", Operation,
+           (unsigned long long)FunctionCost, (unsigned long long)Function->Accesses.Reads, (unsigned long long)Function->Accesses.Writes,
+           (unsigned long long)HandleCost, (unsigned long long)Handle->Accesses.Reads, (unsigned long long)Handle->Accesses.Writes,
+           HandleCost ? ((double)FunctionCost / (double)HandleCost) : 0.0);
+}
+
+static void ReportPath(const char *Operation, const char *Path, Result_t const *Result)
+{
+    printf("%-22s %-26s %8llu %4llu/%-4llu\n", Operation, Path, (unsigned long long)(Result->Instructions - Overhead),
+           (unsigned long long)Result->Accesses.Reads, (unsigned long long)Result->Accesses.Writes);
+}
+
+static void WriteBusPinByPin(GPIO_PinID_t const *Pins, uint32_t Value)
+{
+    uint32_t idx;
+
+    for(idx = 0; idx < BUS_WIDTH; idx++)
+    {
+        GPIO_setPinValue(Pins[idx].Port, Pins[idx].PinNumber, ((Value >> idx) & 1UL) ? GPIO_PINSTATE_SET : GPIO_PINSTATE_RESET);
+    }
+}
+
+int main(void)
+{
+    Result_t Empty;
+    Result_t Function;
+    Result_t Handle;
+    Result_t Path;
+
+    LED_Init();
+    Switch_init();
+    Sim_setPinInput(SIM_PERIPH_GPIOA, SWITCH_LEDTOGGLE_PIN, 0);
+
+    MEASURE(&Empty, SIM_PERIPH_GPIOA, (void)0);
+    Overhead = Empty.Instructions;
+
+    printf("Host instructions and register reads/writes per call (instrumentation overhead of %llu removed)\n\n",
+           (unsigned long long)Overhead);
+    printf("%-22s %8s %-9s %8s %-9s %8s\n", "Operation", "Function", " R/W", "Handle", " R/W", "Speedup");
+
+    MEASURE(&Function, SIM_PERIPH_GPIOA, GPIO_setPinValue(GPIO_GPIOA, GPIO_PIN2, GPIO_PINSTATE_SET));
+    MEASURE(&Handle, SIM_PERIPH_GPIOA, GPIO_pinWrite(GPIO_PIN_HANDLE(GPIO_GPIOA, GPIO_PIN2), GPIO_PINSTATE_SET));
+    Report("GPIO pin write", &Function, &Handle);
+
+    MEASURE(&Function, SIM_PERIPH_GPIOA, Sink = GPIO_getPinValue(GPIO_GPIOA, GPIO_PIN3));
+    MEASURE(&Handle, SIM_PERIPH_GPIOA, Sink = GPIO_pinRead(GPIO_PIN_HANDLE(GPIO_GPIOA, GPIO_PIN3)));
+    Report("GPIO pin read", &Function, &Handle);
+
+    MEASURE(&Function, SIM_PERIPH_GPIOA, LED_setLedState(LED_GREEN, LED_ON));
+    MEASURE(&Handle, SIM_PERIPH_GPIOA, LED_setLedStateFast(LED_GREEN, LED_ON));
+    Report("LED set", &Function, &Handle);
+
+    MEASURE(&Function, SIM_PERIPH_GPIOA, LED_setLedState(LED_GREEN, (LED_getLedState(LED_GREEN) == LED_ON) ? LED_OFF : LED_ON));
+    MEASURE(&Handle, SIM_PERIPH_GPIOA, LED_toggleLedFast(LED_GREEN));
+    Report("LED toggle", &Function, &Handle);
+
+    MEASURE(&Function, SIM_PERIPH_GPIOA, Sink = Switch_getSwitchState(SWITCH_LEDTOGGLE));
+    MEASURE(&Handle, SIM_PERIPH_GPIOA, Sink = Switch_getSwitchStateFast(SWITCH_LEDTOGGLE));
+    Report("Switch read", &Function, &Handle);
+
+    printf("\n%-22s %-26s %8s %-9s\n", "Single-bit access", "Path", "Instr", " R/W");
+
+    MEASURE(&Path, SIM_PERIPH_GPIOA, GPIOA_REGS->ODR |= (1UL << GPIO_PIN2));
+    ReportPath("GPIO pin set", "ODR read-modify-write", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, GPIO_pinSet(GPIO_PIN_HANDLE(GPIO_GPIOA, GPIO_PIN2)));
+    ReportPath("", "BSRR store", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, GPIO_pinWriteBitBand(GPIO_GPIOA, GPIO_PIN2, GPIO_PINSTATE_SET));
+    ReportPath("", "ODR bit-band store", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, GPIO_setPinValue(GPIO_GPIOA, GPIO_PIN2, GPIO_PINSTATE_SET));
+    ReportPath("", "GPIO_setPinValue()", &Path);
+
+    MEASURE(&Path, SIM_PERIPH_GPIOA, Sink = (GPIOA_REGS->IDR >> GPIO_PIN3) & 1UL);
+    ReportPath("GPIO pin read", "IDR load, shift and mask", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, Sink = GPIO_pinReadBitBand(GPIO_GPIOA, GPIO_PIN3));
+    ReportPath("", "IDR bit-band load", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, Sink = GPIO_getPinValue(GPIO_GPIOA, GPIO_PIN3));
+    ReportPath("", "GPIO_getPinValue()", &Path);
+
+    MEASURE(&Path, SIM_PERIPH_RCC, RCC_CR |= (1UL << 0));
+    ReportPath("RCC_CR flag set", "read-modify-write", &Path);
+    MEASURE(&Path, SIM_PERIPH_RCC, *BITBAND_PERIPH(RCC_CR_ADDRESS, 0) = 1);
+    ReportPath("", "bit-band store", &Path);
+    MEASURE(&Path, SIM_PERIPH_RCC, Sink = RCC_CR & (1UL << 1));
+    ReportPath("RCC_CR flag poll", "load and mask", &Path);
+    MEASURE(&Path, SIM_PERIPH_RCC, Sink = *BITBAND_PERIPH(RCC_CR_ADDRESS, 1));
+    ReportPath("", "bit-band load", &Path);
+
+    /* SysTick is on the private peripheral bus, which has no bit-band alias */
+    MEASURE(&Path, SIM_PERIPH_SYSTICK, SYSTICK_CTRL &= ~1UL);
+    ReportPath("SysTick stop", "CTRL read-modify-write", &Path);
+    MEASURE(&Path, SIM_PERIPH_SYSTICK, SYSTICK_CTRL = 0);
+    ReportPath("", "CTRL store (SysTick.c)", &Path);
+
+    GPIO_initPinGroup(&FieldGroup, FieldPins, BUS_WIDTH);
+    GPIO_initPinGroupLut(&ScatteredGroup, ScatteredPins, BUS_WIDTH, ScatteredLut);
+    GPIO_initPinGroup(&TwoPortGroup, TwoPortPins, BUS_WIDTH);
+
+    printf("\n%-22s %-26s %8s %-9s\n", "Byte bus write", "Path", "Instr", " R/W");
+
+    MEASURE(&Path, SIM_PERIPH_GPIOA, WriteBusPinByPin(FieldPins, 0xA5));
+    ReportPath("PA2..PA9", "GPIO_setPinValue() x8", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, GPIO_writePortField(GPIO_GPIOA, GPIO_PIN2, BUS_WIDTH, 0xA5));
+    ReportPath("", "GPIO_writePortField()", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, GPIO_writePinGroup(&FieldGroup, 0xA5));
+    ReportPath("", "pin group, field", &Path);
+
+    MEASURE(&Path, SIM_PERIPH_GPIOA, WriteBusPinByPin(ScatteredPins, 0xA5));
+    ReportPath("8 scattered GPIOA pins", "GPIO_setPinValue() x8", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, GPIO_writePinGroup(&ScatteredGroup, 0xA5));
+    ReportPath("", "pin group, lookup table", &Path);
+
+    /* Accesses of the GPIOA half, GPIOB takes as many */
+    MEASURE(&Path, SIM_PERIPH_GPIOA, GPIO_writePinGroup(&TwoPortGroup, 0xA5));
+    ReportPath("PA2..PA5, PB0..PB3", "pin group, pin by pin", &Path);
+
+    MEASURE(&Path, SIM_PERIPH_GPIOA, Sink = GPIO_readPinGroup(&FieldGroup));
+    ReportPath("PA2..PA9 read", "pin group, field", &Path);
+    MEASURE(&Path, SIM_PERIPH_GPIOA, Sink = GPIO_readPinGroup(&ScatteredGroup));
+    ReportPath("8 scattered pins read", "pin group, pin by pin", &Path);
+
+    return 0;
+}
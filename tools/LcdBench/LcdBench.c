@@ -0,0 +1,168 @@
+/**
+ * @file LcdBench.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Counts the GPIO register writes the LCD driver makes per character against the per-pin and
+ *        pin group paths it replaced.
+ * @version 0.1
+ * @date 2024-04-14
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Runs on the simulated register backend (host/Sim) with the board configuration of LCD_Cfg.c. The driver
+ * is brought up with LCD_task(), then a string is written and the writes to the port of the data bus are
+ * divided by its length. The reference paths send the same characters with the GPIO functions.
+ *
+ * Usage: LcdBench
+ */
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdio.h>
+#include "Sim/Sim.h"
+#include "MCAL/GPIO/GPIO.h"
+#include "MCAL/DWT/DWT.h"
+#include "HAL/LCD/LCD.h"
+#include "HAL/LCD/LCD_Cfg.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define TEXT        "0123456789abcdef"
+#define TEXT_LENGTH (sizeof(TEXT) - 1UL)
+
+/* Period of the LCD_task() calls, 1 ms */
+#define TASK_PERIOD_CYCLES  (DWT_CLOCK_HZ / 1000UL)
+#define MAX_TASK_CALLS      1000UL
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+static GPIO_PinGroup_t BusGroup;
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static void RunUntilReady(void);
+static void PulseEnable(void);
+static void SendPinByPin(uint8_t Char);
+static void SendPinGroup(uint8_t Char);
+static double WritesPerChar(void (*Send)(uint8_t Char));
+static void Report(const char *Path, double Writes);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+void assert_failed(uint8_t *file, uint32_t line)
+{
+    fprintf(stderr, "assert failed: %s:%lu\n", (const char *)file, (unsigned long)line);
+}
+
+static void RunUntilReady(void)
+{
+    uint32_t Calls = 0;
+
+    do
+    {
+        LCD_task();
+        DWT_delayCycles(TASK_PERIOD_CYCLES);
+        Calls++;
+    } while((LCD_getState(LCD1) != LCD_STATE_READY) && (Calls < MAX_TASK_CALLS));
+}
+
+static void PulseEnable(void)
+{
+    LCD_Config_t const *CurrentLCD = &(LCD_Config[LCD1]);
+
+    GPIO_setPinValue((GPIO_Port_t)CurrentLCD->EnablePin.PortID, (GPIO_Pin_t)CurrentLCD->EnablePin.PinNum, GPIO_PINSTATE_SET);
+    GPIO_setPinValue((GPIO_Port_t)CurrentLCD->EnablePin.PortID, (GPIO_Pin_t)CurrentLCD->EnablePin.PinNum, GPIO_PINSTATE_RESET);
+}
+
+static void SendPinByPin(uint8_t Char)
+{
+    LCD_Config_t const *CurrentLCD = &(LCD_Config[LCD1]);
+    uint32_t idx;
+
+    GPIO_setPinValue((GPIO_Port_t)CurrentLCD->RSPin.PortID, (GPIO_Pin_t)CurrentLCD->RSPin.PinNum, GPIO_PINSTATE_SET);
+    for(idx = 0; idx < 8; idx++)
+    {
+        GPIO_setPinValue((GPIO_Port_t)CurrentLCD->Pins[idx].PortID, (GPIO_Pin_t)CurrentLCD->Pins[idx].PinNum,
+                         ((Char >> idx) & 1U) ? GPIO_PINSTATE_SET : GPIO_PINSTATE_RESET);
+    }
+    PulseEnable();
+}
+
+static void SendPinGroup(uint8_t Char)
+{
+    LCD_Config_t const *CurrentLCD = &(LCD_Config[LCD1]);
+
+    GPIO_setPinValue((GPIO_Port_t)CurrentLCD->RSPin.PortID, (GPIO_Pin_t)CurrentLCD->RSPin.PinNum, GPIO_PINSTATE_SET);
+    GPIO_writePinGroup(&BusGroup, Char);
+    PulseEnable();
+}
+
+/**
+ * @brief Sends TEXT with @p Send, or with the LCD driver if NULL, and returns the writes per character.
+ */
+static double WritesPerChar(void (*Send)(uint8_t Char))
+{
+    Sim_AccessCount_t Accesses;
+    uint32_t idx;
+
+    Sim_resetAccessCounts();
+    if(Send != NULL)
+    {
+        for(idx = 0; idx < TEXT_LENGTH; idx++)
+        {
+            Send((uint8_t)TEXT[idx]);
+        }
+    }
+    else
+    {
+        (void)LCD_writeStringAsync(LCD1, TEXT, TEXT_LENGTH);
+        RunUntilReady();
+    }
+    Sim_getAccessCount((Sim_Peripheral_t)(SIM_PERIPH_GPIOA + LCD_Config[LCD1].Pins[0].PortID), &Accesses);
+
+    return (double)Accesses.Writes / (double)TEXT_LENGTH;
+}
+
+static void Report(const char *Path, double Writes)
+{
+    printf("%-36s %12.2f\n", Path, Writes);
+}
+
+int main(void)
+{
+    LCD_Config_t const *CurrentLCD = &(LCD_Config[LCD1]);
+    GPIO_PinID_t GroupPins[8];
+    uint32_t idx;
+
+    if(CurrentLCD->DataLength != LCD_DL_8BIT)
+    {
+        fprintf(stderr, "LcdBench expects the 8-bit data bus of the board configuration\n");
+        return 1;
+    }
+
+    for(idx = 0; idx < 8; idx++)
+    {
+        GroupPins[idx].Port      = (GPIO_Port_t)CurrentLCD->Pins[idx].PortID;
+        GroupPins[idx].PinNumber = (GPIO_Pin_t)CurrentLCD->Pins[idx].PinNum;
+    }
+    GPIO_initPinGroup(&BusGroup, GroupPins, 8);
+
+    LCD_init(LCD1);
+    RunUntilReady();
+
+    printf("Register writes per character on the port of the data bus, %lu-character string\n\n", (unsigned long)TEXT_LENGTH);
+    printf("%-36s %12s\n", "Path", "Writes/char");
+    Report("GPIO_setPinValue(), pin by pin", WritesPerChar(SendPinByPin));
+    Report("GPIO_setPinValue() RS/EN, pin group", WritesPerChar(SendPinGroup));
+    Report("LCD driver, BSRR tables", WritesPerChar(NULL));
+
+    return 0;
+}
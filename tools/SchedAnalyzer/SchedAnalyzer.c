@@ -0,0 +1,362 @@
+/**
+ * @file SchedAnalyzer.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Host-side schedulability and load analyzer of the Sched_Runnables table.
+ * @version 0.1
+ * @date 2024-04-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Builds the per-tick load of the static runnables over one hyperperiod from their
+ * DelayMS/PeriodicityMS and worst-case execution times, reports the load histogram and the
+ * worst tick, then suggests DelayMS phase offsets that spread the load.
+ *
+ * Usage: SchedAnalyzer [-w <WCETFile>]
+ *   WCETFile holds measured figures overriding SchedAnalyzer_WCETUS, one "<RunnableIndex> <WCETUS>"
+ *   pair per line, lines starting with '#' are ignored.
+ *
+ * Exit status: 0 when the configuration is schedulable, 1 when it is not, 2 on error.
+ */
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "SchedAnalyzer_cfg.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define TICK_TIMEUS         (SCHEDANALYZER_TICK_TIMEMS * 1000UL)
+#define TICK_BUDGETUS       ((TICK_TIMEUS * SCHEDANALYZER_TICK_BUDGET_PERCENT) / 100UL)
+
+#define EXIT_SCHEDULABLE        0
+#define EXIT_NOT_SCHEDULABLE    1
+#define EXIT_ERROR              2
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Runnable as seen by the analyzer, times are in ticks.
+ */
+typedef struct
+{
+    uint32_t Index;         /**< Index in Sched_Runnables */
+    uint32_t PeriodTicks;   /**< Period, at least one tick like in the scheduler */
+    uint32_t DelayTicks;    /**< First activation */
+    uint32_t WCETUS;        /**< Worst-case execution time in microseconds */
+} Task_t;
+
+/**
+ * @brief Result of the load analysis over one hyperperiod.
+ */
+typedef struct
+{
+    uint64_t WorstLoadUS;       /**< Highest load of a single tick */
+    uint32_t WorstTick;         /**< First tick of the hyperperiod having that load */
+    uint64_t TotalLoadUS;       /**< Sum of the load of every tick */
+    uint32_t Histogram[SCHEDANALYZER_HISTOGRAM_BUCKETS + 1]; /**< Tick count per load bucket, the last one counts overloaded ticks */
+} LoadReport_t;
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+extern Sched_Runnable_Config_t Sched_Runnables[_NUM_OF_RUNNABLES];
+
+static Task_t Tasks[_NUM_OF_RUNNABLES];
+static uint32_t NumOfTasks;
+
+/* Load of each tick of the hyperperiod in microseconds */
+static uint32_t *TickLoad;
+static uint32_t Hyperperiod;
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static uint32_t GCD(uint32_t a, uint32_t b);
+static int ReadWCETFile(const char *Path);
+static int CollectTasks(void);
+static void AddTask(Task_t const *Task, uint32_t ShiftTicks);
+static void AnalyzeLoad(LoadReport_t *Report);
+static void PrintReport(const char *Title, LoadReport_t const *Report);
+static uint32_t FindBestShift(Task_t const *Task);
+static int CompareTasks(const void *a, const void *b);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+static uint32_t GCD(uint32_t a, uint32_t b)
+{
+    while(b)
+    {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static int ReadWCETFile(const char *Path)
+{
+    FILE *File = fopen(Path, "r");
+    char Line[128];
+    uint32_t LineNum = 0;
+
+    if(File == NULL)
+    {
+        fprintf(stderr, "error: can not open %s\n", Path);
+        return -1;
+    }
+
+    while(fgets(Line, sizeof(Line), File))
+    {
+        unsigned long Index;
+        unsigned long WCETUS;
+        LineNum++;
+
+        if((Line[0] == '#') || (strspn(Line, " \t\r\n") == strlen(Line)))
+        {
+            continue;
+        }
+        if((sscanf(Line, "%lu %lu", &Index, &WCETUS) != 2) || (Index >= _NUM_OF_RUNNABLES))
+        {
+            fprintf(stderr, "error: %s:%u: expected \"<RunnableIndex> <WCETUS>\"\n", Path, LineNum);
+            fclose(File);
+            return -1;
+        }
+        SchedAnalyzer_WCETUS[Index] = (uint32_t)WCETUS;
+    }
+
+    fclose(File);
+    return 0;
+}
+
+static int CollectTasks(void)
+{
+    uint32_t idx;
+    uint64_t LCM = 1;
+
+    for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
+    {
+        Sched_Runnable_Config_t const *Runnable = &Sched_Runnables[idx];
+        Task_t *Task = &Tasks[NumOfTasks];
+
+        /* Slots without a callback are not scheduled */
+        if(Runnable->CallBack == NULL)
+        {
+            continue;
+        }
+
+        Task->Index = idx;
+        Task->PeriodTicks = Runnable->PeriodicityMS / SCHEDANALYZER_TICK_TIMEMS;
+        Task->PeriodTicks = Task->PeriodTicks ? Task->PeriodTicks : 1;
+        Task->DelayTicks = Runnable->DelayMS / SCHEDANALYZER_TICK_TIMEMS;
+        Task->WCETUS = SchedAnalyzer_WCETUS[idx];
+        NumOfTasks++;
+
+        LCM = (LCM / GCD((uint32_t)LCM, Task->PeriodTicks)) * Task->PeriodTicks;
+        if(LCM > SCHEDANALYZER_MAX_HYPERPERIOD)
+        {
+            fprintf(stderr, "error: hyperperiod exceeds %lu ticks\n", SCHEDANALYZER_MAX_HYPERPERIOD);
+            return -1;
+        }
+    }
+
+    Hyperperiod = (uint32_t)LCM;
+    return 0;
+}
+
+/* In steady state a runnable loads the ticks congruent to its phase, whatever its first activation */
+static void AddTask(Task_t const *Task, uint32_t ShiftTicks)
+{
+    uint32_t Tick;
+    for(Tick = (Task->DelayTicks + ShiftTicks) % Task->PeriodTicks; Tick < Hyperperiod; Tick += Task->PeriodTicks)
+    {
+        TickLoad[Tick] += Task->WCETUS;
+    }
+}
+
+static void AnalyzeLoad(LoadReport_t *Report)
+{
+    uint32_t Tick;
+
+    memset(Report, 0, sizeof(*Report));
+    for(Tick = 0; Tick < Hyperperiod; Tick++)
+    {
+        uint32_t Bucket = (uint32_t)(((uint64_t)TickLoad[Tick] * SCHEDANALYZER_HISTOGRAM_BUCKETS) / TICK_TIMEUS);
+
+        Report->Histogram[(Bucket < SCHEDANALYZER_HISTOGRAM_BUCKETS) ? Bucket : SCHEDANALYZER_HISTOGRAM_BUCKETS]++;
+        Report->TotalLoadUS += TickLoad[Tick];
+        if(TickLoad[Tick] > Report->WorstLoadUS)
+        {
+            Report->WorstLoadUS = TickLoad[Tick];
+            Report->WorstTick = Tick;
+        }
+    }
+}
+
+static void PrintReport(const char *Title, LoadReport_t const *Report)
+{
+    uint32_t Bucket;
+
+    printf("\n%s\n", Title);
+    printf("  worst tick load   : %llu us (%.1f%% of the tick) at tick %u of the hyperperiod\n",
+           (unsigned long long)Report->WorstLoadUS, (100.0 * (double)Report->WorstLoadUS) / TICK_TIMEUS, Report->WorstTick);
+    printf("  average CPU load  : %.2f%%\n", (100.0 * (double)Report->TotalLoadUS) / ((double)Hyperperiod * TICK_TIMEUS));
+    printf("  tick load histogram:\n");
+    for(Bucket = 0; Bucket < SCHEDANALYZER_HISTOGRAM_BUCKETS; Bucket++)
+    {
+        printf("    %3lu%% - %3lu%% : %u ticks\n",
+               (Bucket * 100UL) / SCHEDANALYZER_HISTOGRAM_BUCKETS, ((Bucket + 1) * 100UL) / SCHEDANALYZER_HISTOGRAM_BUCKETS,
+               Report->Histogram[Bucket]);
+    }
+    printf("         >= 100%% : %u ticks\n", Report->Histogram[SCHEDANALYZER_HISTOGRAM_BUCKETS]);
+}
+
+/**
+ * Picks the phase shift minimizing the worst tick once the task is added, ties are broken
+ * by the load already present on the ticks it would use, then by the smallest shift.
+ */
+static uint32_t FindBestShift(Task_t const *Task)
+{
+    uint32_t BestShift = 0;
+    uint64_t BestWorst = UINT64_MAX;
+    uint64_t BestSum = UINT64_MAX;
+    uint64_t CurrentWorst = 0;
+    uint32_t Shift;
+    uint32_t Tick;
+
+    for(Tick = 0; Tick < Hyperperiod; Tick++)
+    {
+        CurrentWorst = (TickLoad[Tick] > CurrentWorst) ? TickLoad[Tick] : CurrentWorst;
+    }
+
+    for(Shift = 0; Shift < Task->PeriodTicks; Shift++)
+    {
+        uint64_t Worst = CurrentWorst;
+        uint64_t Sum = 0;
+
+        for(Tick = (Task->DelayTicks + Shift) % Task->PeriodTicks; Tick < Hyperperiod; Tick += Task->PeriodTicks)
+        {
+            uint64_t Load = (uint64_t)TickLoad[Tick] + Task->WCETUS;
+            Worst = (Load > Worst) ? Load : Worst;
+            Sum += TickLoad[Tick];
+        }
+
+        if((Worst < BestWorst) || ((Worst == BestWorst) && (Sum < BestSum)))
+        {
+            BestWorst = Worst;
+            BestSum = Sum;
+            BestShift = Shift;
+        }
+    }
+
+    return BestShift;
+}
+
+/* Shortest periods first as they constrain the placement the most, then the longest WCET */
+static int CompareTasks(const void *a, const void *b)
+{
+    Task_t const *TaskA = (Task_t const *)a;
+    Task_t const *TaskB = (Task_t const *)b;
+
+    if(TaskA->PeriodTicks != TaskB->PeriodTicks)
+    {
+        return (TaskA->PeriodTicks < TaskB->PeriodTicks) ? -1 : 1;
+    }
+    if(TaskA->WCETUS != TaskB->WCETUS)
+    {
+        return (TaskA->WCETUS > TaskB->WCETUS) ? -1 : 1;
+    }
+    return (TaskA->Index < TaskB->Index) ? -1 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    LoadReport_t Current;
+    LoadReport_t Suggested;
+    Task_t Sorted[_NUM_OF_RUNNABLES];
+    uint32_t Shifts[_NUM_OF_RUNNABLES] = {0};
+    uint64_t Utilization = 0;
+    uint32_t idx;
+    int Schedulable;
+
+    if((argc == 3) && (strcmp(argv[1], "-w") == 0))
+    {
+        if(ReadWCETFile(argv[2]) != 0)
+        {
+            return EXIT_ERROR;
+        }
+    }
+    else if(argc != 1)
+    {
+        fprintf(stderr, "usage: %s [-w <WCETFile>]\n", argv[0]);
+        return EXIT_ERROR;
+    }
+
+    if(CollectTasks() != 0)
+    {
+        return EXIT_ERROR;
+    }
+    TickLoad = calloc(Hyperperiod, sizeof(*TickLoad));
+    if(TickLoad == NULL)
+    {
+        fprintf(stderr, "error: out of memory\n");
+        return EXIT_ERROR;
+    }
+
+    printf("Scheduler configuration: %u runnables, tick %lu ms, budget %lu us per tick\n",
+           NumOfTasks, SCHEDANALYZER_TICK_TIMEMS, TICK_BUDGETUS);
+    printf("  %-8s %10s %10s %10s %8s\n", "Runnable", "DelayMS", "PeriodMS", "WCET us", "Load");
+    for(idx = 0; idx < NumOfTasks; idx++)
+    {
+        Task_t const *Task = &Tasks[idx];
+        Utilization += ((uint64_t)Task->WCETUS * 1000000UL) / ((uint64_t)Task->PeriodTicks * TICK_TIMEUS);
+        printf("  %-8u %10lu %10lu %10u %7.2f%%\n", Task->Index, Task->DelayTicks * SCHEDANALYZER_TICK_TIMEMS,
+               Task->PeriodTicks * SCHEDANALYZER_TICK_TIMEMS, Task->WCETUS,
+               (100.0 * Task->WCETUS) / ((double)Task->PeriodTicks * TICK_TIMEUS));
+        AddTask(Task, 0);
+    }
+    printf("Hyperperiod: %lu ms\n", Hyperperiod * SCHEDANALYZER_TICK_TIMEMS);
+
+    AnalyzeLoad(&Current);
+    PrintReport("Current phasing:", &Current);
+
+    Schedulable = (Current.WorstLoadUS <= TICK_BUDGETUS);
+    printf("\nSchedulability: %s (worst tick %llu us, budget %lu us, utilization %.2f%%)\n",
+           Schedulable ? "OK" : "OVERLOADED", (unsigned long long)Current.WorstLoadUS, TICK_BUDGETUS,
+           (double)Utilization / 10000.0);
+
+    /* Greedy placement of the runnables one by one on an empty hyperperiod */
+    memcpy(Sorted, Tasks, NumOfTasks * sizeof(Task_t));
+    qsort(Sorted, NumOfTasks, sizeof(Task_t), CompareTasks);
+    memset(TickLoad, 0, Hyperperiod * sizeof(*TickLoad));
+    for(idx = 0; idx < NumOfTasks; idx++)
+    {
+        Shifts[Sorted[idx].Index] = FindBestShift(&Sorted[idx]);
+        AddTask(&Sorted[idx], Shifts[Sorted[idx].Index]);
+    }
+
+    AnalyzeLoad(&Suggested);
+    PrintReport("Suggested phasing:", &Suggested);
+    printf("  DelayMS offsets for Sched_Runnables:\n");
+    for(idx = 0; idx < NumOfTasks; idx++)
+    {
+        Task_t const *Task = &Tasks[idx];
+        printf("    [%u] .DelayMS = %lu,%s\n", Task->Index,
+               (Task->DelayTicks + Shifts[Task->Index]) * SCHEDANALYZER_TICK_TIMEMS,
+               Shifts[Task->Index] ? "" : " /* unchanged */");
+    }
+
+    free(TickLoad);
+    return Schedulable ? EXIT_SCHEDULABLE : EXIT_NOT_SCHEDULABLE;
+}
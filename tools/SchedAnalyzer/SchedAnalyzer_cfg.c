@@ -0,0 +1,28 @@
+/**
+ * @file SchedAnalyzer_cfg.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Worst-case execution time annotations of the scheduler runnables.
+ * @version 0.1
+ * @date 2024-04-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include "SchedAnalyzer_cfg.h"
+#include "HAL/LCD/LCD_Cfg.h"
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+
+/* Keep in sync with Sched_Runnables, figures come from Sched_getStats() on the target.
+   LCD_task() may busy-wait up to LCD_WAIT_BUDGET_US for each LCD on top of its own processing. */
+uint32_t SchedAnalyzer_WCETUS[_NUM_OF_RUNNABLES] =
+{
+    [SCHED_LCD]     = 20 + (_NUM_OF_LCDS * LCD_WAIT_BUDGET_US),
+    [SCHED_LCDAPP]  = 15,
+};
@@ -0,0 +1,65 @@
+/**
+ * @file SchedAnalyzer_cfg.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Configuration of the host-side schedulability analyzer.
+ * @version 0.1
+ * @date 2024-04-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TOOLS_SCHEDANALYZER_SCHEDANALYZER_CFG_H_
+#define TOOLS_SCHEDANALYZER_SCHEDANALYZER_CFG_H_
+
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdint.h>
+#include "Services/Scheduler/Scheduler_cfg.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Duration of a scheduler tick in milliseconds, must match the scheduler.
+ */
+#define SCHEDANALYZER_TICK_TIMEMS 1UL
+
+/**
+ * @brief Fraction of a tick, in percent, that the runnables are allowed to use.
+ *
+ * The rest is left for the interrupts and the scheduler itself.
+ */
+#define SCHEDANALYZER_TICK_BUDGET_PERCENT 90UL
+
+/**
+ * @brief Longest hyperperiod, in ticks, that the analyzer accepts.
+ */
+#define SCHEDANALYZER_MAX_HYPERPERIOD 10000000UL
+
+/**
+ * @brief Number of buckets of the per-tick load histogram, each covering an equal share of a tick.
+ */
+#define SCHEDANALYZER_HISTOGRAM_BUCKETS 10UL
+
+
+/********************************************************************************************************/
+/************************************************Types***************************************************/
+/********************************************************************************************************/
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Worst-case execution time of each runnable of Sched_Runnables in microseconds.
+ *
+ * Can be overridden at runtime with measured figures, see the usage of the analyzer.
+ */
+extern uint32_t SchedAnalyzer_WCETUS[_NUM_OF_RUNNABLES];
+
+
+#endif // TOOLS_SCHEDANALYZER_SCHEDANALYZER_CFG_H_
@@ -0,0 +1,183 @@
+/**
+ * @file SchedStatsTest.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Checks the execution time statistics returned by Sched_getStats().
+ * @version 0.1
+ * @date 2024-04-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Runs the scheduler on the simulated register backend (host/Sim), built with SCHED_PROFILING_ENABLED.
+ * The runnables registered here wait known durations on the DWT clock, then suspend themselves after
+ * a known number of executions. The DWT is built with DWT_HOST_CLOCK_ENABLED at 0, it counts the
+ * simulated time only, so the statistics match those durations whatever the load of the host.
+ * DURATION_TOLERANCE_US only covers the rounding of the expected mean.
+ *
+ * Usage: SchedStatsTest, returns 0 when every check passes.
+ */
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdio.h>
+#include "Sim/Sim.h"
+#include "MCAL/DWT/DWT.h"
+#include "Services/Scheduler/Scheduler.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+#define US_TO_CYCLES(TimeUS) DWT_NS_TO_CYCLES((TimeUS) * 1000UL)
+
+#define DURATION_TOLERANCE_US 1UL
+
+/* Executions of each runnable before it suspends itself */
+#define STEPS_RUNS      7UL
+#define CONSTANT_RUNS   4UL
+
+#define CONSTANT_US     1500UL
+
+#define SIM_DURATION_MS 50UL
+
+#define NUM_OF_STEPS 3UL
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+
+/* Durations of the steps runnable, its executions cycle through them */
+static const uint32_t StepsUS[NUM_OF_STEPS] = {1000UL, 3000UL, 2000UL};
+
+static uint32_t StepsID;
+static uint32_t ConstantID;
+static uint32_t IdleID;
+static uint32_t StepsCount;
+static uint32_t ConstantCount;
+static uint32_t Failures;
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static void StepsRunnable(void);
+static void ConstantRunnable(void);
+static void IdleRunnable(void);
+static void Entry(void);
+static void CheckDuration(const char *Name, uint32_t Cycles, uint32_t ExpectedUS);
+static void CheckValue(const char *Name, uint32_t Value, uint32_t Expected);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+void assert_failed(uint8_t *file, uint32_t line)
+{
+    fprintf(stderr, "assert failed: %s:%lu\n", (const char *)file, (unsigned long)line);
+    Failures++;
+}
+
+static void StepsRunnable(void)
+{
+    DWT_delayCycles(US_TO_CYCLES(StepsUS[StepsCount % NUM_OF_STEPS]));
+    StepsCount++;
+    if(StepsCount == STEPS_RUNS)
+    {
+        (void)Sched_suspend(StepsID);
+    }
+}
+
+static void ConstantRunnable(void)
+{
+    DWT_delayCycles(US_TO_CYCLES(CONSTANT_US));
+    ConstantCount++;
+    if(ConstantCount == CONSTANT_RUNS)
+    {
+        (void)Sched_suspend(ConstantID);
+    }
+}
+
+static void IdleRunnable(void)
+{
+}
+
+static void Entry(void)
+{
+    Sched_Runnable_Config_t const Steps = {.CallBack = StepsRunnable, .PeriodicityMS = 2, .OverrunPolicy = SCHED_OVERRUN_SKIP};
+    Sched_Runnable_Config_t const Constant = {.CallBack = ConstantRunnable, .PeriodicityMS = 3, .OverrunPolicy = SCHED_OVERRUN_SKIP};
+    Sched_Runnable_Config_t const Idle = {.CallBack = IdleRunnable, .DelayMS = 1000, .OverrunPolicy = SCHED_OVERRUN_SKIP};
+
+    Sched_init();
+    if((Sched_registerRunnable(&Steps, &StepsID) != SCHED_OK) ||
+       (Sched_registerRunnable(&Constant, &ConstantID) != SCHED_OK) ||
+       (Sched_registerRunnable(&Idle, &IdleID) != SCHED_OK))
+    {
+        printf("FAIL registering the runnables\n");
+        Failures++;
+        return;
+    }
+    Sched_start();
+}
+
+static void CheckDuration(const char *Name, uint32_t Cycles, uint32_t ExpectedUS)
+{
+    uint32_t MinCycles = US_TO_CYCLES(ExpectedUS);
+    uint32_t MaxCycles = US_TO_CYCLES(ExpectedUS + DURATION_TOLERANCE_US);
+    uint32_t IsPass = (Cycles >= MinCycles) && (Cycles <= MaxCycles);
+
+    printf("%-4s %-26s %10lu cycles, expected %lu us\n", IsPass ? "PASS" : "FAIL", Name,
+           (unsigned long)Cycles, (unsigned long)ExpectedUS);
+    Failures += !IsPass;
+}
+
+static void CheckValue(const char *Name, uint32_t Value, uint32_t Expected)
+{
+    uint32_t IsPass = (Value == Expected);
+
+    printf("%-4s %-26s %10lu, expected %lu\n", IsPass ? "PASS" : "FAIL", Name, (unsigned long)Value, (unsigned long)Expected);
+    Failures += !IsPass;
+}
+
+int main(void)
+{
+    Sched_RunnableStats_t Stats;
+    uint32_t StepsTotalUS = 0;
+    uint32_t idx;
+
+    (void)Sim_run(Entry, SIM_DURATION_MS);
+
+    for(idx = 0; idx < STEPS_RUNS; idx++)
+    {
+        StepsTotalUS += StepsUS[idx % NUM_OF_STEPS];
+    }
+
+    if(Sched_getStats(StepsID, &Stats) != SCHED_OK)
+    {
+        printf("FAIL Sched_getStats(), is SCHED_PROFILING_ENABLED set?\n");
+        return 1;
+    }
+    CheckValue("steps count", Stats.InvocationCount, STEPS_RUNS);
+    CheckDuration("steps min", Stats.MinCycles, 1000UL);
+    CheckDuration("steps max", Stats.MaxCycles, 3000UL);
+    CheckDuration("steps mean", Stats.MeanCycles, StepsTotalUS / STEPS_RUNS);
+    CheckDuration("steps last", Stats.LastCycles, StepsUS[(STEPS_RUNS - 1) % NUM_OF_STEPS]);
+
+    (void)Sched_getStats(ConstantID, &Stats);
+    CheckValue("constant count", Stats.InvocationCount, CONSTANT_RUNS);
+    CheckDuration("constant min", Stats.MinCycles, CONSTANT_US);
+    CheckDuration("constant max", Stats.MaxCycles, CONSTANT_US);
+    CheckDuration("constant mean", Stats.MeanCycles, CONSTANT_US);
+    CheckDuration("constant last", Stats.LastCycles, CONSTANT_US);
+
+    /* Never executed, every field reads 0 */
+    (void)Sched_getStats(IdleID, &Stats);
+    CheckValue("idle count", Stats.InvocationCount, 0);
+    CheckValue("idle min", Stats.MinCycles, 0);
+    CheckValue("idle max", Stats.MaxCycles, 0);
+    CheckValue("idle mean", Stats.MeanCycles, 0);
+    CheckValue("idle last", Stats.LastCycles, 0);
+
+    printf("%s, %lu failure(s)\n", Failures ? "FAILED" : "OK", (unsigned long)Failures);
+    return Failures ? 1 : 0;
+}
@@ -0,0 +1,290 @@
+/**
+ * @file SchedTableGen.c
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Generates the cyclic-executive dispatch table of the Sched_Runnables table.
+ * @version 0.1
+ * @date 2024-04-05
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Expands DelayMS/PeriodicityMS of the static runnables into one slot per tick: a prologue
+ * covering the first activations followed by one hyperperiod that repeats forever. The result is
+ * written as Scheduler_table.c for the SCHED_DISPATCH_TABLE mode, together with the timing of each
+ * runnable so the scheduler can detect a table older than Scheduler_cfg.c.
+ *
+ * When the configuration can not be tabulated (footprint too large, overrun policy other than
+ * catching up) an invalid table is written and the scheduler uses the heap instead.
+ *
+ * Usage: SchedTableGen <OutputFile>
+ */
+/********************************************************************************************************/
+/************************************************Includes************************************************/
+/********************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "SchedTableGen_cfg.h"
+#include "Services/Scheduler/Scheduler.h"
+#include "Services/Scheduler/Scheduler_cfg.h"
+
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/* Sizes on the 32-bit target */
+#define TABLE_HEADER_BYTES      32UL
+#define SIGNATURE_BYTES         16UL
+#define SLOTSTART_BYTES         2UL
+#define CALL_BYTES              1UL
+
+#define MAX_CALLS               0xFFFFUL
+#define MAX_RUNNABLES           0xFFUL
+
+#define VALUES_PER_LINE         16UL
+
+
+/********************************************************************************************************/
+/************************************************Variables***********************************************/
+/********************************************************************************************************/
+extern Sched_Runnable_Config_t Sched_Runnables[_NUM_OF_RUNNABLES];
+
+static uint64_t Hyperperiod;
+static uint64_t PrologueSlots;
+static uint64_t NumOfSlots;
+static uint64_t NumOfCalls;
+static uint64_t Footprint;
+
+
+/********************************************************************************************************/
+/*****************************************Static Functions Prototype*************************************/
+/********************************************************************************************************/
+static uint64_t GCD(uint64_t a, uint64_t b);
+static uint64_t PeriodTicks(uint32_t idx);
+static uint64_t DelayTicks(uint32_t idx);
+static const char *Analyze(void);
+static void WriteHeader(FILE *File, const char *InvalidReason);
+static void WriteTable(FILE *File);
+static void WriteInvalidTable(FILE *File);
+
+
+/********************************************************************************************************/
+/*********************************************APIs Implementation****************************************/
+/********************************************************************************************************/
+
+static uint64_t GCD(uint64_t a, uint64_t b)
+{
+    while(b)
+    {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Same rounding as the scheduler: a zero periodicity runs every tick */
+static uint64_t PeriodTicks(uint32_t idx)
+{
+    uint64_t Period = Sched_Runnables[idx].PeriodicityMS / SCHEDTABLEGEN_TICK_TIMEMS;
+    return Period ? Period : 1;
+}
+
+static uint64_t DelayTicks(uint32_t idx)
+{
+    return Sched_Runnables[idx].DelayMS / SCHEDTABLEGEN_TICK_TIMEMS;
+}
+
+/**
+ * Computes the table dimensions without building it.
+ * Returns NULL when the configuration can be tabulated, the reason otherwise.
+ */
+static const char *Analyze(void)
+{
+    uint32_t idx;
+
+    if(_NUM_OF_RUNNABLES > MAX_RUNNABLES)
+    {
+        return "too many runnables for 8-bit indexes";
+    }
+
+    Hyperperiod = 1;
+    PrologueSlots = 0;
+    for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
+    {
+        if(Sched_Runnables[idx].CallBack == NULL)
+        {
+            continue;
+        }
+        if(Sched_Runnables[idx].OverrunPolicy != SCHED_OVERRUN_CATCHUP)
+        {
+            return "only the catch-up overrun policy can be tabulated";
+        }
+
+        Hyperperiod = (Hyperperiod / GCD(Hyperperiod, PeriodTicks(idx))) * PeriodTicks(idx);
+        if(Hyperperiod > (SCHEDTABLEGEN_MAX_FOOTPRINT / SLOTSTART_BYTES))
+        {
+            return "hyperperiod too long";
+        }
+        PrologueSlots = (DelayTicks(idx) > PrologueSlots) ? DelayTicks(idx) : PrologueSlots;
+    }
+    NumOfSlots = PrologueSlots + Hyperperiod;
+
+    NumOfCalls = 0;
+    for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
+    {
+        if((Sched_Runnables[idx].CallBack != NULL) && (DelayTicks(idx) < NumOfSlots))
+        {
+            NumOfCalls += ((NumOfSlots - 1 - DelayTicks(idx)) / PeriodTicks(idx)) + 1;
+        }
+    }
+
+    Footprint = TABLE_HEADER_BYTES + (_NUM_OF_RUNNABLES * SIGNATURE_BYTES) +
+                ((NumOfSlots + 1) * SLOTSTART_BYTES) + (NumOfCalls * CALL_BYTES);
+    if((NumOfCalls > MAX_CALLS) || (Footprint > SCHEDTABLEGEN_MAX_FOOTPRINT))
+    {
+        return "table footprint too large";
+    }
+
+    return NULL;
+}
+
+static void WriteHeader(FILE *File, const char *InvalidReason)
+{
+    fprintf(File,
+            "/**\n"
+            " * @file Scheduler_table.c\n"
+            " * @brief Dispatch table of Sched_Runnables for the SCHED_DISPATCH_TABLE mode.\n"
+            " * \n"
+            " * Generated by tools/SchedTableGen from Scheduler_cfg.c, do not edit.\n"
+            " * Run `make sched-table` after changing Scheduler_cfg.c, an outdated table is ignored.\n"
+            " * \n");
+    if(InvalidReason)
+    {
+        fprintf(File, " * Not tabulated (%s), the scheduler uses the heap.\n", InvalidReason);
+    }
+    else
+    {
+        fprintf(File,
+                " * Hyperperiod: %llu ms, prologue: %llu slots, %llu slots, %llu calls\n"
+                " * Flash footprint: %llu bytes\n",
+                (unsigned long long)(Hyperperiod * SCHEDTABLEGEN_TICK_TIMEMS), (unsigned long long)PrologueSlots,
+                (unsigned long long)NumOfSlots, (unsigned long long)NumOfCalls, (unsigned long long)Footprint);
+    }
+    fprintf(File,
+            " */\n"
+            "#include \"Scheduler_table.h\"\n"
+            "\n"
+            "#if SCHED_DISPATCH_MODE == SCHED_DISPATCH_TABLE\n"
+            "\n");
+}
+
+static void WriteTable(FILE *File)
+{
+    uint32_t idx;
+    uint64_t Slot;
+    uint64_t Call = 0;
+
+    fprintf(File, "static const Sched_TableSignature_t Signature[%u] =\n{\n", (unsigned)_NUM_OF_RUNNABLES);
+    for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
+    {
+        Sched_Runnable_Config_t const *Runnable = &Sched_Runnables[idx];
+        fprintf(File, "    {%lu, %lu, (Sched_OverrunPolicy_t)%u, %u},\n", (unsigned long)Runnable->DelayMS,
+                (unsigned long)Runnable->PeriodicityMS, (unsigned)Runnable->OverrunPolicy, Runnable->CallBack ? 1U : 0U);
+    }
+    fprintf(File, "};\n\n");
+
+    /* A runnable is due on slot n when n >= Delay and (n - Delay) is a multiple of its period */
+    fprintf(File, "static const uint16_t SlotStart[%llu] =\n{", (unsigned long long)(NumOfSlots + 1));
+    for(Slot = 0; Slot <= NumOfSlots; Slot++)
+    {
+        fprintf(File, "%s%llu,", (Slot % VALUES_PER_LINE) ? " " : "\n    ", (unsigned long long)Call);
+        for(idx = 0; (Slot < NumOfSlots) && (idx < _NUM_OF_RUNNABLES); idx++)
+        {
+            if((Sched_Runnables[idx].CallBack != NULL) && (Slot >= DelayTicks(idx)) && (((Slot - DelayTicks(idx)) % PeriodTicks(idx)) == 0))
+            {
+                Call++;
+            }
+        }
+    }
+    fprintf(File, "\n};\n\n");
+
+    fprintf(File, "static const uint8_t Calls[%llu] =\n{", (unsigned long long)(NumOfCalls ? NumOfCalls : 1));
+    Call = 0;
+    for(Slot = 0; Slot < NumOfSlots; Slot++)
+    {
+        for(idx = 0; idx < _NUM_OF_RUNNABLES; idx++)
+        {
+            if((Sched_Runnables[idx].CallBack != NULL) && (Slot >= DelayTicks(idx)) && (((Slot - DelayTicks(idx)) % PeriodTicks(idx)) == 0))
+            {
+                fprintf(File, "%s%u,", (Call % VALUES_PER_LINE) ? " " : "\n    ", idx);
+                Call++;
+            }
+        }
+    }
+    fprintf(File, "%s\n};\n\n", NumOfCalls ? "" : "\n    0,");
+
+    fprintf(File,
+            "const Sched_Table_t Sched_Table =\n"
+            "{\n"
+            "    .IsValid        = 1,\n"
+            "    .TickTimeMS     = %lu,\n"
+            "    .NumOfRunnables = %u,\n"
+            "    .Signature      = Signature,\n"
+            "    .PrologueSlots  = %llu,\n"
+            "    .NumOfSlots     = %llu,\n"
+            "    .SlotStart      = SlotStart,\n"
+            "    .Calls          = Calls,\n"
+            "};\n",
+            SCHEDTABLEGEN_TICK_TIMEMS, (unsigned)_NUM_OF_RUNNABLES,
+            (unsigned long long)PrologueSlots, (unsigned long long)NumOfSlots);
+}
+
+static void WriteInvalidTable(FILE *File)
+{
+    fprintf(File,
+            "const Sched_Table_t Sched_Table =\n"
+            "{\n"
+            "    .IsValid        = 0,\n"
+            "};\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *InvalidReason;
+    FILE *File;
+
+    if(argc != 2)
+    {
+        fprintf(stderr, "usage: %s <OutputFile>\n", argv[0]);
+        return 1;
+    }
+
+    InvalidReason = Analyze();
+
+    File = fopen(argv[1], "w");
+    if(File == NULL)
+    {
+        fprintf(stderr, "error: can not open %s\n", argv[1]);
+        return 1;
+    }
+
+    WriteHeader(File, InvalidReason);
+    if(InvalidReason)
+    {
+        WriteInvalidTable(File);
+        printf("warning: %s, the table is disabled and the scheduler falls back to the heap\n", InvalidReason);
+    }
+    else
+    {
+        WriteTable(File);
+        printf("Dispatch table: hyperperiod %llu ms, %llu slots (%llu prologue), %llu calls\n",
+               (unsigned long long)(Hyperperiod * SCHEDTABLEGEN_TICK_TIMEMS), (unsigned long long)NumOfSlots,
+               (unsigned long long)PrologueSlots, (unsigned long long)NumOfCalls);
+        printf("Flash footprint: %llu bytes (limit %lu)\n", (unsigned long long)Footprint, SCHEDTABLEGEN_MAX_FOOTPRINT);
+    }
+    fprintf(File, "\n#endif\n");
+
+    fclose(File);
+    return 0;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file SchedTableGen_cfg.h
+ * @author Ziad Gamalelden (ziad.gamalelden@gmail.com)
+ * @brief Configuration of the dispatch table generator.
+ * @version 0.1
+ * @date 2024-04-05
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TOOLS_SCHEDTABLEGEN_SCHEDTABLEGEN_CFG_H_
+#define TOOLS_SCHEDTABLEGEN_SCHEDTABLEGEN_CFG_H_
+
+/********************************************************************************************************/
+/************************************************Defines*************************************************/
+/********************************************************************************************************/
+
+/**
+ * @brief Duration of a scheduler tick in milliseconds, checked against the scheduler at runtime.
+ */
+#define SCHEDTABLEGEN_TICK_TIMEMS 1UL
+
+/**
+ * @brief Largest flash footprint of the table, in bytes, before falling back to the heap mode.
+ */
+#define SCHEDTABLEGEN_MAX_FOOTPRINT 8192UL
+
+
+#endif // TOOLS_SCHEDTABLEGEN_SCHEDTABLEGEN_CFG_H_